@@ -0,0 +1,20 @@
+/* Automatically generated by configure */
+#ifndef GF_CONFIG_H
+#define GF_CONFIG_H
+#define GPAC_CONFIGURATION ""
+#define GF_STATIC static
+#define GPAC_HAS_MTIM_NSEC
+#define GPAC_CONFIG_LINUX
+#define GPAC_HAS_QJS
+#define GPAC_HAS_SSL
+#define GPAC_HAS_POLL
+#define GPAC_64_BITS
+#define GPAC_HAS_JPEG
+#define GPAC_HAS_PNG
+#define GPAC_HAS_SOCK_UN
+#define GPAC_HAS_IFADDRS
+#define GPAC_HAS_LZMA
+#define GPAC_HAS_CURL
+#define GPAC_HAS_IPV6
+#define GPAC_HAS_LINUX_DVB
+#endif
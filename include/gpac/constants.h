@@ -310,6 +310,53 @@ const char *gf_pixel_fmt_all_shortnames();
 */
 Bool gf_pixel_get_size_info(GF_PixelFormat pixfmt, u32 width, u32 height, u32 *out_size, u32 *out_stride, u32 *out_stride_uv, u32 *out_planes, u32 *out_plane_uv_height);
 
+/*! plane layout of a raw video frame*/
+typedef struct
+{
+	/*! number of planes*/
+	u32 nb_planes;
+	/*! stride in bytes of each plane*/
+	u32 stride[4];
+	/*! number of lines of each plane*/
+	u32 height[4];
+	/*! number of bytes per line of each plane, without padding*/
+	u32 line_size[4];
+	/*! offset in bytes of each plane when all planes are contiguous*/
+	u32 offset[4];
+	/*! size in bytes of the frame when all planes are contiguous*/
+	u32 size;
+} GF_PixelPlanes;
+
+/*! gets plane layout of a frame for the pixel format. Unlike \ref gf_pixel_get_size_info, extra planes (alpha, depth) use the stride and height of the first plane
+\param pixfmt  pixfmt format code
+\param width frame width
+\param height frame height
+\param stride stride of first plane, 0 for no padding
+\param stride_uv stride of UV planes, 0 for default
+\param[out] planes plane layout
+\return GF_TRUE if success, GF_FALSE if pixel format is not supported
+*/
+Bool gf_pixel_get_planes(GF_PixelFormat pixfmt, u32 width, u32 height, u32 stride, u32 stride_uv, GF_PixelPlanes *planes);
+
+/*! copies lines of a plane. Lines are copied in a single pass if both source and destination strides equal the line size, and non-temporal stores are used for large planes when available
+\param dst destination plane
+\param dst_stride destination stride in bytes
+\param src source plane
+\param src_stride source stride in bytes
+\param line_size number of bytes to copy per line
+\param nb_lines number of lines to copy
+*/
+void gf_pixel_copy_plane(u8 *dst, u32 dst_stride, const u8 *src, u32 src_stride, u32 line_size, u32 nb_lines);
+
+/*! copies all planes of a frame
+\param layout plane layout of the frame, as retrieved by \ref gf_pixel_get_planes
+\param dst_planes destination planes
+\param dst_strides destination strides, or NULL to use layout strides
+\param src_planes source planes
+\param src_strides source strides, or NULL to use layout strides
+*/
+void gf_pixel_copy_frame(const GF_PixelPlanes *layout, u8 *dst_planes[4], const u32 *dst_strides, const u8 *src_planes[4], const u32 *src_strides);
+
 /*! Gets the number of bytes per pixel on first plane
 \param pixfmt  pixel format code
 \return number of bytes per pixel
@@ -1215,6 +1215,7 @@ enum
 	GF_PROP_PID_CENC_HAS_ROLL = GF_4CC('C','R','O','L'),
 	GF_PROP_PID_AMR_MODE_SET = GF_4CC('A','M','S','T'),
 	GF_PROP_PCK_SUBS = GF_4CC('S','U','B','S'),
+	GF_PROP_PCK_NALU_HDRS = GF_4CC('N','H','D','S'),
 	GF_PROP_PID_MAX_NALU_SIZE = GF_4CC('N','A','L','S'),
 	GF_PROP_PCK_FILENUM = GF_4CC('F','N','U','M'),
 	GF_PROP_PCK_FILENAME = GF_4CC('F','N','A','M'),
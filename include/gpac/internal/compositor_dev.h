@@ -307,6 +307,7 @@ struct __tag_compositor
 
 	s32 subtx, subty, subd, audd;
 	u32 subfs;
+	Bool burnin;
 
 	u64 hint_extra_scene_cts_plus_one;
 	u32 hint_extra_scene_dur_plus_one;
@@ -366,6 +367,23 @@ struct __tag_compositor
 	//once buffering is done
 	Bool passthrough_check_buffer;
 
+	//set if burn-in is used for the current frame: overlays are drawn in dirty-rect mode on a transparent RGBA canvas
+	//and blended on a copy of the passthrough frame
+	Bool burn_active;
+	//set when the overlay canvas was redrawn since the last cache build
+	Bool burn_dirty;
+	//overlay canvas, display size
+	u8 *burn_buffer;
+	u32 burn_buffer_size, burn_buffer_alloc;
+	//premultiplied overlay and inverse alpha of the covered rectangle, in output frame layout
+	u8 *burn_cache;
+	u32 burn_cache_alloc;
+	//covered rectangle in pixels, empty if no overlay
+	GF_IRect burn_rc;
+	//number of planes in cache, and for each plane: byte offset in line, first line, bytes per line, number of lines and offset in cache
+	u32 burn_nb_planes;
+	u32 burn_px[4], burn_py[4], burn_pw[4], burn_ph[4], burn_poff[4];
+
 	//debug non-immediate mode ny erasing the parts that would have been drawn
 	Bool debug_defer;
 
@@ -1215,6 +1233,8 @@ void gf_mixer_add_input(GF_AudioMixer *am, GF_AudioInterface *src);
 void gf_mixer_remove_input(GF_AudioMixer *am, GF_AudioInterface *src);
 void gf_mixer_lock(GF_AudioMixer *am, Bool lockIt);
 void gf_mixer_set_max_speed(GF_AudioMixer *am, Double max_speed);
+/*enable TPDF dithering when reducing bit depth of mixed samples*/
+void gf_mixer_set_dither(GF_AudioMixer *am, Bool dither);
 
 /*mix inputs in buffer, return number of bytes written to output*/
 u32 gf_mixer_get_output(GF_AudioMixer *am, void *buffer, u32 buffer_size, u32 delay_ms);
@@ -538,6 +538,10 @@ struct __tag_rtp_depacketizer
 
 	/*! inter-packet reconstruction bitstream (for 3GP text and H264)*/
 	GF_BitStream *inter_bs;
+	/*! buffer recycled across fragmented NAL reconstructions (H264/HEVC/VVC), owned by inter_bs while a NAL is being gathered*/
+	u8 *frag_buf;
+	/*! allocated size of frag_buf*/
+	u32 frag_alloc;
 
 	/*! H264/AVC config*/
 	u32 h264_pck_mode;
@@ -4174,6 +4174,12 @@ struct __tag_isom {
 	GF_ISOCompressMode compress_mode;
 	u32 compress_flags;
 	u32 pad_cmov;
+	//zlib level+1 (0 means default level 9) and strategy
+	u32 compress_level_plus_one, compress_strategy;
+	//compressor and box serialization buffer, reused across compressed boxes
+	GF_GZCompressor *gz_comp;
+	u8 *comp_buf;
+	u32 comp_buf_alloc;
 #endif
 
 	void (*progress_cbk)(void *udta, u64 nb_done, u64 nb_total);
@@ -50,6 +50,7 @@ struct s_playList {
 	double computed_duration;
 	Bool is_ended;
 	GF_List *elements; /*PlaylistElement*/
+	int nb_skipped_segments; /*number of media segments before the first element, not loaded since already known*/
 };
 typedef struct s_playList Playlist;
 
@@ -138,6 +139,19 @@ GF_Err gf_m3u8_parse_master_playlist(const char *file, MasterPlaylist **playlist
  */
 GF_Err gf_m3u8_parse_sub_playlist(const char *file, MasterPlaylist **playlist, const char *baseURL, Stream *in_program, PlaylistElement *sub_playlist, Bool is_master);
 
+/**
+ * Parse the given media playlist file, only loading segments following a segment already known from a previous parse.
+ * If the known segment is not found in the playlist, all segments are loaded.
+\param file The file from cache to parse
+\param playlist The playlist to fill, must point to NULL
+\param baseURL base URL of the playlist
+\param known_url URL of the last segment already known, or NULL to load all segments. This segment and the following ones are loaded
+\param known_start_range start of byte range of the known segment, 0 if none
+\param known_end_range end of byte range of the known segment, 0 if none
+\return GF_OK if playlist valid
+ */
+GF_Err gf_m3u8_parse_media_playlist_update(const char *file, MasterPlaylist **playlist, const char *baseURL, const char *known_url, u64 known_start_range, u64 known_end_range);
+
 /**
  * Deletes the given MasterPlaylist and all of its sub elements
  */
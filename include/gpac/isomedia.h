@@ -2263,6 +2263,14 @@ enum
 */
 GF_Err gf_isom_enable_compression(GF_ISOFile *isom_file, GF_ISOCompressMode compress_mode, u32 compress_flags);
 
+/*! sets zlib parameters used for box compression. Must be called before writing any compressed box
+\param isom_file the target ISO file
+\param level compression level from 0 (store) to 9 (best, default)
+\param strategy zlib compression strategy (0: default, 1: filtered, 2: huffman only, 3: RLE, 4: fixed)
+\return error if any
+*/
+GF_Err gf_isom_set_compression_level(GF_ISOFile *isom_file, u32 level, u32 strategy);
+
 /*! sets the copyright in one language
 \param isom_file the target ISO file
 \param threeCharCode the ISO three character language code for copyright
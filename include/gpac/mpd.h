@@ -147,6 +147,8 @@ typedef struct
 {
 	/*! list of entries*/
 	GF_List *entries;
+	/*! GPAC internal: compiled index of entries, built on first lookup and rebuilt whenever entries are modified*/
+	struct __mpd_timeline_index *index;
 } GF_MPD_SegmentTimeline;
 
 /*! Byte range info*/
@@ -625,6 +627,10 @@ typedef struct {
 	u32 m3u8_low_latency;
 	/*! internal, HLS:  sequence number of last indeendent  segment or PART in playlist*/
 	u32 m3u8_media_seq_indep_last;
+	/*! internal, HLS: URL of last segment already known when refreshing playlist, only following segments are loaded*/
+	char *m3u8_known_url;
+	/*! internal, HLS: byte range of last segment already known when refreshing playlist, 0 if none*/
+	u64 m3u8_known_start_range, m3u8_known_end_range;
 
 	/*! GPAC dasher context*/
 	GF_DASH_SegmenterContext *dasher_ctx;
@@ -1221,6 +1227,23 @@ GF_Err gf_mpd_get_segment_start_time_with_timescale(s32 in_segment_index,
 	GF_MPD_Period const * const in_period, GF_MPD_AdaptationSet const * const in_set, GF_MPD_Representation const * const in_rep,
 	u64 *out_segment_start_time, u64 *out_opt_segment_duration, u32 *out_opt_scale);
 
+/*! gets start time and duration of a segment in a segment timeline
+\param timeline the target segment timeline
+\param segment_index the 0-based index of the segment in the timeline
+\param out_start_time set to the start time of the segment in the timeline timescale, or to the end time of the timeline if the segment is not in the timeline
+\param out_duration set to the duration of the segment in the timeline timescale - untouched if the segment is not in the timeline (optional, may be NULL)
+\return GF_EOS if the segment is not in the timeline, error if any
+*/
+GF_Err gf_mpd_segment_timeline_get_segment(GF_MPD_SegmentTimeline *timeline, u32 segment_index, u64 *out_start_time, u32 *out_duration);
+
+/*! gets the first segment starting at or after a given time in a segment timeline
+\param timeline the target segment timeline
+\param time the target time in the timeline timescale
+\param out_start_time set to the start time of the segment in the timeline timescale, or to the end time of the timeline if no such segment (optional, may be NULL)
+\return the 0-based index of the segment in the timeline, or the number of segments in the timeline if no such segment
+*/
+u32 gf_mpd_segment_timeline_find_segment(GF_MPD_SegmentTimeline *timeline, u64 time, u64 *out_start_time);
+
 /*! MPD seek mode*/
 typedef enum {
 	/*! will return the segment containing the requested time*/
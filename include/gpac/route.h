@@ -247,6 +247,13 @@ GF_Err gf_route_dmx_process(GF_ROUTEDmx *routedmx);
  */
 GF_Err gf_route_dmx_set_reorder(GF_ROUTEDmx *routedmx, Bool reorder_needed, u32 timeout_us);
 
+/*! Sets number of worker threads. Services are assigned to threads in round-robin order, each thread reading the sockets of its services and appending received data to the object currently being received by the service. Object creation and completion, signaling and event callbacks are still done in the thread calling \ref gf_route_dmx_process, progress events being merged into one event per service and per call. Ignored when network capture is used on the demultiplexer sockets.
+\param routedmx the ROUTE demultiplexer
+\param nb_threads number of worker threads, 0 disables threading. This can only be called once
+\return error code if any
+ */
+GF_Err gf_route_dmx_set_threads(GF_ROUTEDmx *routedmx, u32 nb_threads);
+
 /*! Progressive dispatch mode for LCT objects*/
 typedef enum
 {
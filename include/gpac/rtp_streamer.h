@@ -338,6 +338,26 @@ u32 gf_rtp_streamer_get_ssrc(GF_RTPStreamer *streamer);
 */
 u32 gf_rtp_streamer_get_timescale(GF_RTPStreamer *streamer);
 
+/*! attaches a mirror streamer to a source streamer. Each RTP packet built by the source packetizer is also sent on the channel of the mirror, using the sequence number and SSRC of the mirror and the source timestamp shifted by the given offset. The packet payload is not copied, and the packetizer of the mirror is not used.
+The mirror is automatically detached when either streamer is destroyed.
+\param streamer the source RTP streamer
+\param mirror the mirror RTP streamer, shall have the same payload type as the source
+\param ts_offset offset in RTP timescale added to the source timestamps
+\return error if any
+*/
+GF_Err gf_rtp_streamer_add_mirror(GF_RTPStreamer *streamer, GF_RTPStreamer *mirror, u32 ts_offset);
+
+/*! detaches a mirror streamer from its source streamer
+\param mirror the mirror RTP streamer
+*/
+void gf_rtp_streamer_remove_mirror(GF_RTPStreamer *mirror);
+
+/*! mutes the channel of a streamer. When muted, packets (including RTCP reports) are no longer sent on the channel of the streamer but are still forwarded to its mirrors
+\param streamer the target RTP streamer
+\param mute if GF_TRUE, channel is muted
+*/
+void gf_rtp_streamer_mute(GF_RTPStreamer *streamer, Bool mute);
+
 /*! @} */
 
 #ifdef __cplusplus
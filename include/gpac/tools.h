@@ -2091,6 +2091,34 @@ Compresses a data buffer in place using zlib/deflate. Buffer may be reallocated
  */
 GF_Err gf_gz_compress_payload_ex(u8 **data, u32 data_len, u32 *out_size, u8 data_offset, Bool skip_if_larger, u8 **out_comp_data, Bool use_gz);
 
+/*! zlib compressor object, keeping deflate state and output buffer across calls*/
+typedef struct __gf_gz_compressor GF_GZCompressor;
+
+/**
+Creates a new zlib/deflate compressor.
+\param level compression level from 0 (store) to 9 (best). A negative value selects zlib default level
+\param strategy zlib compression strategy (0: default, 1: filtered, 2: huffman only, 3: RLE, 4: fixed)
+\return new compressor or NULL if error
+ */
+GF_GZCompressor *gf_gz_compressor_new(s32 level, u32 strategy);
+
+/**
+Destroys a zlib compressor.
+\param gzc the compressor to destroy
+ */
+void gf_gz_compressor_del(GF_GZCompressor *gzc);
+
+/**
+Compresses a data buffer using a zlib compressor. The output is produced in the same format as \ref gf_gz_compress_payload_ex without GZ header.
+\param gzc the target compressor
+\param data the data buffer to be compressed
+\param data_len length of the data buffer to be compressed
+\param out_data set to the compressed data. This buffer is owned by the compressor and is only valid until the next call to this function or compressor destruction
+\param out_size set to the size of the compressed data
+\return error if any
+ */
+GF_Err gf_gz_compressor_process(GF_GZCompressor *gzc, const u8 *data, u32 data_len, u8 **out_data, u32 *out_size);
+
 /**
 Decompresses a data buffer using zlib/inflate.
 \param data data buffer to be decompressed
@@ -84,6 +84,15 @@ struct __audiomix
 
 	s32 *output;
 	u32 output_size;
+
+	/*deinterleaved mix for planar output*/
+	s32 *planar;
+	u32 planar_size;
+	/*dithering for bit depth reduction*/
+	Bool dither;
+	u32 dither_seed;
+	/*set when last output was a direct copy of a single source*/
+	Bool passthrough;
 };
 
 #define swap_16(x) (( (x) << 8 & 0xff00) | ((x) >> 8 & 0x00ff))
@@ -125,6 +134,11 @@ void gf_mixer_set_max_speed(GF_AudioMixer *am, Double max_speed)
 	am->max_speed = FLT2FIX(max_speed);
 }
 
+void gf_mixer_set_dither(GF_AudioMixer *am, Bool dither)
+{
+	am->dither = dither;
+}
+
 GF_EXPORT
 void gf_mixer_del(GF_AudioMixer *am)
 {
@@ -132,6 +146,7 @@ void gf_mixer_del(GF_AudioMixer *am)
 	gf_list_del(am->sources);
 	gf_mx_del(am->mx);
 	if (am->output) gf_free(am->output);
+	if (am->planar) gf_free(am->planar);
 	gf_free(am);
 }
 
@@ -942,20 +957,199 @@ static void gf_mixer_fetch_input(GF_AudioMixer *am, MixerInput *in, u32 audio_de
 	in->in_bytes_used += 1;
 }
 
-GF_EXPORT
-u32 gf_mixer_get_output(GF_AudioMixer *am, void *buffer, u32 buffer_size, u32 delay)
+/*TPDF dither noise in ]-scale, scale[, using a simple LCG*/
+static GFINLINE s32 gf_mixer_dither(GF_AudioMixer *am, s32 scale)
+{
+	s32 r1, r2;
+	am->dither_seed = am->dither_seed * 1664525 + 1013904223;
+	r1 = (s32) ((am->dither_seed >> 8) % (u32) scale);
+	am->dither_seed = am->dither_seed * 1664525 + 1013904223;
+	r2 = (s32) ((am->dither_seed >> 8) % (u32) scale);
+	return r1 - r2;
+}
+
+/*reduce mixed samples to a lower bit depth, samples are written back in place as s32 in range [min, max]*/
+static void gf_mixer_reduce_depth(GF_AudioMixer *am, s32 *mix, u32 nb_samples, s32 scale, s32 min, s32 max)
+{
+	u32 i;
+	if (am->dither) {
+		for (i=0; i<nb_samples; i++) {
+			s64 samp = (s64) mix[i] + gf_mixer_dither(am, scale);
+			samp /= scale;
+			mix[i] = (s32) ((samp>max) ? max : ((samp<min) ? min : samp));
+		}
+		return;
+	}
+	//no dependency between samples, let the compiler vectorize this
+	for (i=0; i<nb_samples; i++) {
+		s32 samp = mix[i] / scale;
+		mix[i] = (samp>max) ? max : ((samp<min) ? min : samp);
+	}
+}
+
+/*byte-swap nb_samples samples of nb_bytes each*/
+static void gf_mixer_swap_bytes(u8 *data, u32 nb_samples, u32 nb_bytes)
+{
+	u32 i;
+	if (nb_bytes==2) {
+		u16 *d = (u16 *) data;
+		for (i=0; i<nb_samples; i++)
+			d[i] = (u16) ((d[i]<<8) | (d[i]>>8));
+	} else if (nb_bytes==4) {
+		u32 *d = (u32 *) data;
+		for (i=0; i<nb_samples; i++) {
+			u32 v = d[i];
+			d[i] = (v<<24) | ((v<<8) & 0x00FF0000) | ((v>>8) & 0x0000FF00) | (v>>24);
+		}
+	} else if (nb_bytes==8) {
+		u64 *d = (u64 *) data;
+		for (i=0; i<nb_samples; i++) {
+			u64 v = d[i];
+			v = ((v<<8) & 0xFF00FF00FF00FF00ULL) | ((v>>8) & 0x00FF00FF00FF00FFULL);
+			v = ((v<<16) & 0xFFFF0000FFFF0000ULL) | ((v>>16) & 0x0000FFFF0000FFFFULL);
+			d[i] = (v<<32) | (v>>32);
+		}
+	}
+}
+
+/*convert mixed samples (interleaved s32) to output format, nb_samples being the number of samples per channel
+Conversion always operates on contiguous samples: planar output deinterleaves the mix first, and endianness is fixed in a final pass*/
+static void gf_mixer_write_output(GF_AudioMixer *am, u8 *buffer, u32 nb_samples)
+{
+	u32 i, j, nb_ch = am->nb_channels;
+	u32 total = nb_samples * nb_ch;
+	s32 *mix = am->output;
+	Bool swap;
+	u32 afmt = am->afmt;
+
+	if (!total) return;
+
+	if ((nb_ch>1) && gf_audio_fmt_is_planar(afmt)) {
+		if (am->planar_size < total) {
+			am->planar = gf_realloc(am->planar, sizeof(s32) * total);
+			if (!am->planar) {
+				am->planar_size = 0;
+				return;
+			}
+			am->planar_size = total;
+		}
+		for (j=0; j<nb_ch; j++) {
+			s32 *src = am->output + j;
+			s32 *dst = am->planar + j*nb_samples;
+			for (i=0; i<nb_samples; i++) {
+				dst[i] = src[i*nb_ch];
+			}
+		}
+		mix = am->planar;
+	}
+
+	switch (afmt) {
+	case GF_AUDIO_FMT_S16_BE:
+	case GF_AUDIO_FMT_S32_BE:
+	case GF_AUDIO_FMT_FLT_BE:
+	case GF_AUDIO_FMT_DBL_BE:
+#ifdef GPAC_BIG_ENDIAN
+		swap = GF_FALSE;
+#else
+		swap = GF_TRUE;
+#endif
+		break;
+	default:
+#ifdef GPAC_BIG_ENDIAN
+		swap = GF_TRUE;
+#else
+		swap = GF_FALSE;
+#endif
+		break;
+	}
+
+	switch (afmt) {
+	case GF_AUDIO_FMT_S32:
+	case GF_AUDIO_FMT_S32P:
+	case GF_AUDIO_FMT_S32_BE:
+		memcpy(buffer, mix, sizeof(s32) * total);
+		if (swap) gf_mixer_swap_bytes(buffer, total, 4);
+		break;
+	case GF_AUDIO_FMT_FLT:
+	case GF_AUDIO_FMT_FLTP:
+	case GF_AUDIO_FMT_FLT_BE:
+	{
+		Float *out_flt = (Float *)buffer;
+		for (i=0; i<total; i++) {
+			out_flt[i] = ((Float)mix[i]) / GF_INT_MAX;
+		}
+		if (swap) gf_mixer_swap_bytes(buffer, total, 4);
+	}
+		break;
+	case GF_AUDIO_FMT_DBL:
+	case GF_AUDIO_FMT_DBLP:
+	case GF_AUDIO_FMT_DBL_BE:
+	{
+		Double *out_dbl = (Double *)buffer;
+		for (i=0; i<total; i++) {
+			out_dbl[i] = ((Double)mix[i]) / GF_INT_MAX;
+		}
+		if (swap) gf_mixer_swap_bytes(buffer, total, 8);
+	}
+		break;
+	case GF_AUDIO_FMT_S24:
+	case GF_AUDIO_FMT_S24P:
+	case GF_AUDIO_FMT_S24_BE:
+	{
+		Bool is_be = (afmt==GF_AUDIO_FMT_S24_BE) ? GF_TRUE : GF_FALSE;
+		gf_mixer_reduce_depth(am, mix, total, MIX_S24_SCALE, GF_S24_MIN, GF_S24_MAX);
+		for (i=0; i<total; i++) {
+			s32 samp = mix[i];
+			buffer[is_be ? 0 : 2] = (samp>>16) & 0xFF;
+			buffer[1] = (samp>>8) & 0xFF;
+			buffer[is_be ? 2 : 0] = samp & 0xFF;
+			buffer += 3;
+		}
+	}
+		break;
+	case GF_AUDIO_FMT_S16:
+	case GF_AUDIO_FMT_S16P:
+	case GF_AUDIO_FMT_S16_BE:
+	{
+		s16 *out_s16 = (s16 *)buffer;
+		gf_mixer_reduce_depth(am, mix, total, MIX_S16_SCALE, GF_SHORT_MIN, GF_SHORT_MAX);
+		for (i=0; i<total; i++) {
+			out_s16[i] = (s16) mix[i];
+		}
+		if (swap) gf_mixer_swap_bytes(buffer, total, 2);
+	}
+		break;
+	case GF_AUDIO_FMT_U8:
+	case GF_AUDIO_FMT_U8P:
+		gf_mixer_reduce_depth(am, mix, total, MIX_U8_SCALE, -128, 127);
+		for (i=0; i<total; i++) {
+			buffer[i] = (u8) (mix[i] + 128);
+		}
+		break;
+	}
+}
+
+static void gf_mixer_set_passthrough(GF_AudioMixer *am, Bool passthrough)
+{
+	if (am->passthrough == passthrough) return;
+	am->passthrough = passthrough;
+	GF_LOG(GF_LOG_DEBUG, GF_LOG_AUDIO, ("[AudioMixer] %s\n", passthrough ? "Single source in output format, switching to passthrough" : "Switching back to mixing"));
+}
+
+/*returns number of bytes written, the buffer is not cleared beyond that point*/
+static u32 gf_mixer_mix(GF_AudioMixer *am, void *buffer, u32 buffer_size, u32 delay)
 {
 	MixerInput *in, *single_source;
 	Fixed pan[GF_AUDIO_MIXER_MAX_CHANNELS];
 	Bool is_muted, force_mix;
-	u32 i, j, count, size, in_size, nb_samples, nb_written;
+	u32 i, j, count, size, in_size, nb_samples, nb_written, nb_passthrough;
 	s32 *out_mix, nb_act_src;
 	char *data, *ptr;
 
 	am->source_buffering = GF_FALSE;
 	am->nb_eos = 0;
-	//reset buffer whatever the state of the mixer is
-	memset(buffer, 0, buffer_size);
+	//bytes written in passthrough before falling back to full mix
+	nb_passthrough = 0;
 
 	/*the config has changed we don't write to output since settings change*/
 	if (gf_mixer_reconfig(am)) return 0;
@@ -998,8 +1192,11 @@ u32 gf_mixer_get_output(GF_AudioMixer *am, void *buffer, u32 buffer_size, u32 de
 	if (single_source->src->GetSpeed(single_source->src->callback)!=FIX_ONE) goto do_mix;
 	if (single_source->src->GetChannelVolume(single_source->src->callback, pan)) goto do_mix;
 	if (single_source->src->afmt != am->afmt) goto do_mix;
+	/*planar frames cannot be concatenated*/
+	if (gf_audio_fmt_is_planar(am->afmt)) goto do_mix;
 
 single_source_mix:
+	gf_mixer_set_passthrough(am, GF_TRUE);
 
 	ptr = (char *)buffer;
 	in_size = buffer_size;
@@ -1020,6 +1217,8 @@ single_source_mix:
 		if (size > buffer_size) size = buffer_size;
 		if (!is_muted) {
 			memcpy(ptr, data, size);
+		} else {
+			memset(ptr, 0, size);
 		}
 		buffer_size -= size;
 		ptr += size;
@@ -1035,11 +1234,12 @@ single_source_mix:
 			}
 		}
 		gf_mixer_lock(am, GF_FALSE);
-		return (in_size - buffer_size);
+		return nb_passthrough + (in_size - buffer_size);
 	}
 
 	//otherwise, we do have some data but we had a change in config while writing the sample - fallthrough to full mix mode
 	buffer = ptr;
+	nb_passthrough += in_size - buffer_size;
 
 
 do_mix:
@@ -1113,14 +1313,16 @@ do_mix:
 	}
 	if (!nb_act_src) {
 		gf_mixer_lock(am, GF_FALSE);
-		return 0;
+		return nb_passthrough;
 	}
 
 	/*if only one active source in native format, process as single source (direct copy)
 	this is needed because mediaControl on an audio object doesn't deactivate it (eg the audio
 	object is still present in the mixer). this opt is typically useful for language selection
 	content (cf mp4menu)*/
-	if ((nb_act_src==1) && single_source) goto single_source_mix;
+	if ((nb_act_src==1) && single_source && !gf_audio_fmt_is_planar(am->afmt)) goto single_source_mix;
+
+	gf_mixer_set_passthrough(am, GF_FALSE);
 
 	/*step 2, fill all buffers*/
 	while (1) {
@@ -1170,304 +1372,26 @@ do_mix:
 
 	if (!nb_written) {
 		gf_mixer_lock(am, GF_FALSE);
-		return 0;
+		return nb_passthrough;
 	}
 
 	//we do not re-normalize based on the number of input, this is the author's responsibility
-	out_mix = am->output;
-	if (am->afmt == GF_AUDIO_FMT_S32) {
-		s32 *out_s32 = (s32 *)buffer;
-		for (i = 0; i < nb_written; i++) {
-			for (j = 0; j < am->nb_channels; j++) {
-				s32 samp = (*out_mix);
-#ifdef GPAC_BIG_ENDIAN
-				(*out_s32) = swap_32(samp);
-#else
-				(*out_s32) = samp;
-#endif
-				out_s32 += 1;
-				out_mix += 1;
-			}
-		}
-	}
-	else if (am->afmt == GF_AUDIO_FMT_S32P) {
-		s32 *out_s32 = (s32 *) buffer;
-		for (j = 0; j < am->nb_channels; j++) {
-			out_mix = am->output + j;
-			for (i = 0; i < nb_written; i++) {
-				s32 samp = (*out_mix);
-#ifdef GPAC_BIG_ENDIAN
-				(*out_s32) = swap_32(samp);
-#else
-				(*out_s32) = samp;
-#endif
-				out_s32 += 1;
-				out_mix += am->nb_channels;
-			}
-		}
-	}
-	if (am->afmt == GF_AUDIO_FMT_S32_BE) {
-		s32 *out_s32 = (s32 *)buffer;
-		for (i = 0; i < nb_written; i++) {
-			for (j = 0; j < am->nb_channels; j++) {
-				s32 samp = (*out_mix);
-#ifndef GPAC_BIG_ENDIAN
-				(*out_s32) = swap_32(samp);
-#else
-				(*out_s32) = samp;
-#endif
-				out_s32 += 1;
-				out_mix += 1;
-			}
-		}
-	}
-	else if (am->afmt == GF_AUDIO_FMT_FLT) {
-		Float *out_flt = (Float *)buffer;
-#ifdef GPAC_BIG_ENDIAN
-		s32 *out_u32 = (s32 *)buffer;
-#endif
-		for (i = 0; i < nb_written; i++) {
-			for (j = 0; j < am->nb_channels; j++) {
-				s32 samp = (*out_mix);
-				(*out_flt) = ((Float)samp) / GF_INT_MAX;
-				out_flt += 1;
-
-#ifdef GPAC_BIG_ENDIAN
-				(*out_u32) = swap_32(*out_u32);
-				out_u32 += 1;
-#endif
-				out_mix += 1;
-			}
-		}
-	}
-	else if (am->afmt == GF_AUDIO_FMT_FLT_BE) {
-		Float *out_flt = (Float *)buffer;
-#ifndef GPAC_BIG_ENDIAN
-		u32 *out_u32 = (u32 *)buffer;
-#endif
-		for (i = 0; i < nb_written; i++) {
-			for (j = 0; j < am->nb_channels; j++) {
-				s32 samp = (*out_mix);
-				(*out_flt) = ((Float)samp) / GF_INT_MAX;
-				out_flt += 1;
-
-#ifndef GPAC_BIG_ENDIAN
-				(*out_u32) = swap_32(*out_u32);
-				out_u32 += 1;
-#endif
-				out_mix += 1;
-			}
-		}
-	}
-	else if (am->afmt == GF_AUDIO_FMT_FLTP) {
-		Float *out_flt = (Float *)buffer;
-#ifdef GPAC_BIG_ENDIAN
-		u32 *out_u32 = (u32 *)buffer;
-#endif
-		for (j = 0; j < am->nb_channels; j++) {
-			out_mix = am->output + j;
-			for (i = 0; i < nb_written; i++) {
-				s32 samp = (*out_mix);
-				(*out_flt) = ((Float)samp) / GF_INT_MAX;
-				out_flt += 1;
-
-#ifdef GPAC_BIG_ENDIAN
-				(*out_u32) = swap_32(*out_u32);
-				out_u32 += 1;
-#endif
-				out_mix += am->nb_channels;
-			}
-		}
-	}
-	else if (am->afmt == GF_AUDIO_FMT_DBL) {
-		Double *out_dbl = (Double *)buffer;
-#ifdef GPAC_BIG_ENDIAN
-		u64 *out_u64 = (u64 *)buffer;
-#endif
-		for (i = 0; i < nb_written; i++) {
-			for (j = 0; j < am->nb_channels; j++) {
-				s32 samp = (*out_mix);
-				(*out_dbl) = ((Double)samp) / GF_INT_MAX;
-				out_dbl += 1;
-
-#ifdef GPAC_BIG_ENDIAN
-				(*out_u64) = swap_64(*out_u64);
-				out_u64 += 1;
-#endif
-				out_mix += 1;
-			}
-		}
-	}
-	else if (am->afmt == GF_AUDIO_FMT_DBLP) {
-		Double *out_dbl = (Double *)buffer;
-#ifdef GPAC_BIG_ENDIAN
-		u64 *out_u64 = (u64 *)buffer;
-#endif
-		for (j = 0; j < am->nb_channels; j++) {
-			out_mix = am->output + j;
-			for (i = 0; i < nb_written; i++) {
-				s32 samp = (*out_mix);
-				(*out_dbl) = ((Double)samp) / GF_INT_MAX;
-				out_dbl += 1;
-#ifdef GPAC_BIG_ENDIAN
-				(*out_u64) = swap_64(*out_u64);
-				out_u64 += 1;
-#endif
-				out_mix += am->nb_channels;
-			}
-		}
-	}
-	else if (am->afmt == GF_AUDIO_FMT_DBL_BE) {
-		Double *out_dbl = (Double *)buffer;
-#ifndef GPAC_BIG_ENDIAN
-		u64 *out_u64 = (u64 *)buffer;
-#endif
-		for (i = 0; i < nb_written; i++) {
-			for (j = 0; j < am->nb_channels; j++) {
-				s32 samp = (*out_mix);
-				(*out_dbl) = ((Double)samp) / GF_INT_MAX;
-				out_dbl += 1;
-
-#ifndef GPAC_BIG_ENDIAN
-				(*out_u64) = swap_64(*out_u64);
-				out_u64 += 1;
-#endif
-				out_mix += 1;
-			}
-		}
-	} else if (am->afmt == GF_AUDIO_FMT_S24) {
-		s8 *out_s24 = (s8 *)buffer;
-		for (i = 0; i<nb_written; i++) {
-			for (j = 0; j<am->nb_channels; j++) {
-				s32 samp = (*out_mix);
-				samp /= MIX_S24_SCALE;
-				if (samp > GF_S24_MAX) samp = GF_S24_MAX;
-				else if (samp < GF_S24_MIN) samp = GF_S24_MIN;
-				out_s24[2] = (samp>>16) & 0xFF;
-				out_s24[1] = (samp>>8) & 0xFF;
-				out_s24[0] = samp & 0xFF;
-				out_s24 += 3;
-				out_mix += 1;
-			}
-		}
-	} else if (am->afmt == GF_AUDIO_FMT_S24P) {
-		s8 *out_s24 = (s8 *)buffer;
-		for (j = 0; j<am->nb_channels; j++) {
-			out_mix = am->output + j;
-			for (i = 0; i<nb_written; i++) {
-				s32 samp = (*out_mix);
-				samp /= MIX_S24_SCALE;
-				if (samp > GF_S24_MAX) samp = GF_S24_MAX;
-				else if (samp < GF_S24_MIN) samp = GF_S24_MIN;
-				out_s24[2] = (samp>>16) & 0xFF;
-				out_s24[1] = (samp>>8) & 0xFF;
-				out_s24[0] = samp & 0xFF;
-				out_s24 += 3;
-				out_mix += am->nb_channels;
-			}
-		}
-	} else if (am->afmt == GF_AUDIO_FMT_S24_BE) {
-		s8 *out_s24 = (s8 *)buffer;
-		for (i = 0; i<nb_written; i++) {
-			for (j = 0; j<am->nb_channels; j++) {
-				s32 samp = (*out_mix);
-				samp /= MIX_S24_SCALE;
-				if (samp > GF_S24_MAX) samp = GF_S24_MAX;
-				else if (samp < GF_S24_MIN) samp = GF_S24_MIN;
-				out_s24[0] = (samp>>16) & 0xFF;
-				out_s24[1] = (samp>>8) & 0xFF;
-				out_s24[2] = samp & 0xFF;
-				out_s24 += 3;
-				out_mix += 1;
-			}
-		}
-	} else if (am->afmt == GF_AUDIO_FMT_S16) {
-		s16 *out_s16 = (s16 *)buffer;
-		for (i = 0; i<nb_written; i++) {
-			for (j = 0; j<am->nb_channels; j++) {
-				s32 samp = (*out_mix);
-				samp /= MIX_S16_SCALE;
-				if (samp > GF_SHORT_MAX) samp = GF_SHORT_MAX;
-				else if (samp < GF_SHORT_MIN) samp = GF_SHORT_MIN;
-
-#ifdef GPAC_BIG_ENDIAN
-				(*out_s16) = swap_16(samp);
-#else
-				(*out_s16) = samp;
-#endif
-				out_s16 += 1;
-				out_mix += 1;
-			}
-		}
-	} else if (am->afmt == GF_AUDIO_FMT_S16P) {
-		s16 *out_s16 = (s16 *)buffer;
-		for (j = 0; j<am->nb_channels; j++) {
-			out_mix = am->output + j;
-			for (i = 0; i<nb_written; i++) {
-				s32 samp = (*out_mix);
-				samp /= MIX_S16_SCALE;
-				if (samp > GF_SHORT_MAX) samp = GF_SHORT_MAX;
-				else if (samp < GF_SHORT_MIN) samp = GF_SHORT_MIN;
-#ifdef GPAC_BIG_ENDIAN
-				(*out_s16) = swap_16(samp);
-#else
-				(*out_s16) = samp;
-#endif
-				out_s16 += 1;
-				out_mix += am->nb_channels;
-			}
-		}
-	} else if (am->afmt == GF_AUDIO_FMT_S16_BE) {
-		s16 *out_s16 = (s16 *)buffer;
-		for (i = 0; i<nb_written; i++) {
-			for (j = 0; j<am->nb_channels; j++) {
-				s32 samp = (*out_mix);
-				samp /= MIX_S16_SCALE;
-				if (samp > GF_SHORT_MAX) samp = GF_SHORT_MAX;
-				else if (samp < GF_SHORT_MIN) samp = GF_SHORT_MIN;
-
-#ifndef GPAC_BIG_ENDIAN
-				(*out_s16) = swap_16(samp);
-#else
-				(*out_s16) = samp;
-#endif
-				out_s16 += 1;
-				out_mix += 1;
-			}
-		}
-	} else if (am->afmt == GF_AUDIO_FMT_U8) {
-		u8 *out_u8 = (u8 *) buffer;
-		for (i=0; i<nb_written; i++) {
-			for (j=0; j<am->nb_channels; j++) {
-				s32 samp = (*out_mix ) / MIX_U8_SCALE;
-				if (samp > 127) samp = 127;
-				else if (samp < -128) samp = -128;
-				samp += 128;
-				(*out_u8) = (u8) samp;
-				out_u8 += 1;
-				out_mix += 1;
-			}
-		}
-	} else if (am->afmt == GF_AUDIO_FMT_U8P) {
-		s8 *out_s8 = (s8 *) buffer;
-		for (j=0; j<am->nb_channels; j++) {
-			out_mix = am->output + j;
-			for (i=0; i<nb_written; i++) {
-				s32 samp = (*out_mix ) / MIX_U8_SCALE;
-				if (samp > 127) samp = 127;
-				else if (samp < -128) samp = -128;
-				samp += 128;
-				(*out_s8) = samp;
-				out_s8 += 1;
-				out_mix += am->nb_channels;
-			}
-		}
-	}
+	gf_mixer_write_output(am, (u8 *) buffer, nb_written);
 
 	nb_written *= am->nb_channels * am->bit_depth / 8;
 
 	gf_mixer_lock(am, GF_FALSE);
-	return nb_written;
+	return nb_passthrough + nb_written;
+}
+
+GF_EXPORT
+u32 gf_mixer_get_output(GF_AudioMixer *am, void *buffer, u32 buffer_size, u32 delay)
+{
+	u32 written = gf_mixer_mix(am, buffer, buffer_size, delay);
+	//only reset what was not written, gf_mixer_mix returns all bytes written including passthrough ones
+	if (written < buffer_size)
+		memset((u8 *) buffer + written, 0, buffer_size - written);
+	return written;
 }
 
 
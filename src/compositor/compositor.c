@@ -479,6 +479,14 @@ static GF_Err rawvout_lock(struct _video_out *vout, GF_VideoSurface *vi, Bool do
 		memset(vi, 0, sizeof(GF_VideoSurface));
 		vi->width = compositor->display_width;
 		vi->height = compositor->display_height;
+		//burn-in, draw on overlay canvas
+		if (compositor->burn_active) {
+			vi->video_buffer = compositor->burn_buffer;
+			vi->pitch_x = 4;
+			vi->pitch_y = 4 * compositor->display_width;
+			vi->pixel_format = GF_PIXEL_RGBA;
+			return GF_OK;
+		}
 		gf_pixel_get_size_info(pfmt, compositor->display_width, compositor->display_height, NULL, &vi->pitch_y, NULL, NULL, NULL);
 		if (compositor->passthrough_txh && !compositor->passthrough_txh->frame_ifce && (pfmt == compositor->passthrough_txh->pixelformat)) {
 			if (!compositor->passthrough_pck) {
@@ -547,15 +555,323 @@ GF_VideoOutput raw_vout = {
 	.hw_caps = GF_VIDEO_HW_HAS_RGB | GF_VIDEO_HW_HAS_RGBA
 };
 
+#include <gpac/internal/simd_dev.h>
+
+//burn-in overlay cache: each output byte has a premultiplied overlay value P and an inverse alpha IA,
+//blending is then dst = P + dst*IA/255 regardless of the pixel format
+static u32 compositor_burn_rgb_layout(u32 pfmt, s32 *idx)
+{
+	//idx: r, g, b, alpha, unused byte
+	idx[0] = idx[1] = idx[2] = idx[3] = idx[4] = -1;
+	switch (pfmt) {
+	case GF_PIXEL_RGB: idx[0]=0; idx[1]=1; idx[2]=2; return 3;
+	case GF_PIXEL_BGR: idx[0]=2; idx[1]=1; idx[2]=0; return 3;
+	case GF_PIXEL_RGBA: idx[0]=0; idx[1]=1; idx[2]=2; idx[3]=3; return 4;
+	case GF_PIXEL_BGRA: idx[0]=2; idx[1]=1; idx[2]=0; idx[3]=3; return 4;
+	case GF_PIXEL_ARGB: idx[0]=1; idx[1]=2; idx[2]=3; idx[3]=0; return 4;
+	case GF_PIXEL_ABGR: idx[0]=3; idx[1]=2; idx[2]=1; idx[3]=0; return 4;
+	case GF_PIXEL_RGBX: idx[0]=0; idx[1]=1; idx[2]=2; idx[4]=3; return 4;
+	case GF_PIXEL_BGRX: idx[0]=2; idx[1]=1; idx[2]=0; idx[4]=3; return 4;
+	case GF_PIXEL_XRGB: idx[0]=1; idx[1]=2; idx[2]=3; idx[4]=0; return 4;
+	case GF_PIXEL_XBGR: idx[0]=3; idx[1]=2; idx[2]=1; idx[4]=0; return 4;
+	default:
+		return 0;
+	}
+}
+
+static Bool compositor_burn_yuv_layout(u32 pfmt, u32 *sub_x, u32 *sub_y, Bool *semi_planar, Bool *swap_uv)
+{
+	*semi_planar = *swap_uv = GF_FALSE;
+	*sub_x = *sub_y = 2;
+	switch (pfmt) {
+	case GF_PIXEL_YUV: break;
+	case GF_PIXEL_YVU: *swap_uv = GF_TRUE; break;
+	case GF_PIXEL_NV12: *semi_planar = GF_TRUE; break;
+	case GF_PIXEL_NV21: *semi_planar = *swap_uv = GF_TRUE; break;
+	case GF_PIXEL_YUV422: *sub_y = 1; break;
+	case GF_PIXEL_YUV444: *sub_x = *sub_y = 1; break;
+	default:
+		return GF_FALSE;
+	}
+	return GF_TRUE;
+}
+
+static Bool compositor_burn_pfmt_supported(u32 pfmt)
+{
+	s32 idx[5];
+	u32 sx, sy;
+	Bool sp, swap;
+	if (compositor_burn_rgb_layout(pfmt, idx)) return GF_TRUE;
+	return compositor_burn_yuv_layout(pfmt, &sx, &sy, &sp, &swap);
+}
+
+static GFINLINE u8 burn_premul(u32 c, u32 a)
+{
+	return (u8) ((c*a + 127) / 255);
+}
+
+static u8 *compositor_burn_alloc_cache(GF_Compositor *compositor)
+{
+	u32 i, size=0;
+	for (i=0; i<compositor->burn_nb_planes; i++) {
+		compositor->burn_poff[i] = size;
+		size += 2 * compositor->burn_pw[i] * compositor->burn_ph[i];
+	}
+	if (size > compositor->burn_cache_alloc) {
+		compositor->burn_cache = gf_realloc(compositor->burn_cache, size);
+		compositor->burn_cache_alloc = compositor->burn_cache ? size : 0;
+	}
+	return compositor->burn_cache;
+}
+
+//locate the area covered by the overlay and convert it to output layout
+static void compositor_burn_build_cache(GF_Compositor *compositor, u32 pfmt)
+{
+	u32 i, j, k, x0, y0, x1, y1, bpp, sx, sy;
+	s32 idx[5];
+	Bool semi_planar, swap_uv;
+	u32 w = compositor->display_width;
+	u32 h = compositor->display_height;
+	u32 src_pitch = 4*w;
+	GF_IRect *rc = &compositor->burn_rc;
+
+	memset(rc, 0, sizeof(GF_IRect));
+	compositor->burn_nb_planes = 0;
+
+	x0 = w;
+	y0 = h;
+	x1 = y1 = 0;
+	for (j=0; j<h; j++) {
+		u8 *src = compositor->burn_buffer + j*src_pitch;
+		for (i=0; i<w; i++) {
+			if (!src[4*i+3]) continue;
+			if (i<x0) x0 = i;
+			if (i>=x1) x1 = i+1;
+			if (j<y0) y0 = j;
+			y1 = j+1;
+		}
+	}
+	if ((x1<=x0) || (y1<=y0)) return;
+
+	bpp = compositor_burn_rgb_layout(pfmt, idx);
+	if (bpp) {
+		sx = sy = 1;
+	} else if (!compositor_burn_yuv_layout(pfmt, &sx, &sy, &semi_planar, &swap_uv)) {
+		return;
+	}
+	//align on chroma samples
+	x0 = (x0 / sx) * sx;
+	y0 = (y0 / sy) * sy;
+	x1 = MIN( ((x1 + sx - 1) / sx) * sx, (w/sx)*sx);
+	y1 = MIN( ((y1 + sy - 1) / sy) * sy, (h/sy)*sy);
+	if ((x1<=x0) || (y1<=y0)) return;
+
+	rc->x = x0;
+	rc->y = y0;
+	rc->width = x1 - x0;
+	rc->height = y1 - y0;
+
+	if (bpp) {
+		u8 *p, *ia;
+		compositor->burn_nb_planes = 1;
+		compositor->burn_px[0] = x0*bpp;
+		compositor->burn_py[0] = y0;
+		compositor->burn_pw[0] = rc->width*bpp;
+		compositor->burn_ph[0] = rc->height;
+		if (!compositor_burn_alloc_cache(compositor)) {
+			rc->width = 0;
+			return;
+		}
+		p = compositor->burn_cache;
+		ia = p + compositor->burn_pw[0] * compositor->burn_ph[0];
+		for (j=y0; j<y1; j++) {
+			u8 *src = compositor->burn_buffer + j*src_pitch + 4*x0;
+			for (i=x0; i<x1; i++) {
+				u8 a = src[3];
+				for (k=0; k<3; k++) {
+					p[idx[k]] = burn_premul(src[k], a);
+					ia[idx[k]] = 255 - a;
+				}
+				if (idx[3]>=0) {
+					p[idx[3]] = a;
+					ia[idx[3]] = 255 - a;
+				}
+				if (idx[4]>=0) {
+					p[idx[4]] = 0;
+					ia[idx[4]] = 255;
+				}
+				p += bpp;
+				ia += bpp;
+				src += 4;
+			}
+		}
+		return;
+	}
+
+	//luma plane, and chroma plane(s)
+	compositor->burn_px[0] = x0;
+	compositor->burn_py[0] = y0;
+	compositor->burn_pw[0] = rc->width;
+	compositor->burn_ph[0] = rc->height;
+	if (semi_planar) {
+		compositor->burn_nb_planes = 2;
+		compositor->burn_px[1] = 2 * (x0/sx);
+		compositor->burn_pw[1] = 2 * (rc->width/sx);
+	} else {
+		compositor->burn_nb_planes = 3;
+		compositor->burn_px[1] = compositor->burn_px[2] = x0/sx;
+		compositor->burn_pw[1] = compositor->burn_pw[2] = rc->width/sx;
+		compositor->burn_py[2] = y0/sy;
+		compositor->burn_ph[2] = rc->height/sy;
+	}
+	compositor->burn_py[1] = y0/sy;
+	compositor->burn_ph[1] = rc->height/sy;
+
+	if (!compositor_burn_alloc_cache(compositor)) {
+		rc->width = 0;
+		return;
+	}
+
+	for (j=y0; j<y1; j+=sy) {
+		u32 cl = (j-y0)/sy;
+		u8 *p_y = compositor->burn_cache + (j-y0)*compositor->burn_pw[0];
+		u8 *ia_y = p_y + compositor->burn_pw[0]*compositor->burn_ph[0];
+		u8 *p_u, *ia_u, *p_v, *ia_v;
+		u32 c_pitch = 1;
+		if (semi_planar) {
+			p_u = compositor->burn_cache + compositor->burn_poff[1] + cl*compositor->burn_pw[1];
+			ia_u = p_u + compositor->burn_pw[1]*compositor->burn_ph[1];
+			p_v = p_u+1;
+			ia_v = ia_u+1;
+			c_pitch = 2;
+		} else {
+			p_u = compositor->burn_cache + compositor->burn_poff[1] + cl*compositor->burn_pw[1];
+			ia_u = p_u + compositor->burn_pw[1]*compositor->burn_ph[1];
+			p_v = compositor->burn_cache + compositor->burn_poff[2] + cl*compositor->burn_pw[2];
+			ia_v = p_v + compositor->burn_pw[2]*compositor->burn_ph[2];
+		}
+		if (swap_uv) {
+			u8 *tmp = p_u; p_u = p_v; p_v = tmp;
+			tmp = ia_u; ia_u = ia_v; ia_v = tmp;
+		}
+
+		for (i=x0; i<x1; i+=sx) {
+			u32 l, c, sum_a=0, sum_u=0, sum_v=0, n = sx*sy;
+			for (l=0; l<sy; l++) {
+				u8 *src = compositor->burn_buffer + (j+l)*src_pitch + 4*i;
+				for (c=0; c<sx; c++) {
+					u32 a = src[3];
+					GF_Color yuv = gf_evg_argb_to_ayuv(NULL, GF_COL_ARGB(a, src[0], src[1], src[2]));
+					u32 off = l*compositor->burn_pw[0] + (i-x0) + c;
+					p_y[off] = burn_premul(GF_COL_R(yuv), a);
+					ia_y[off] = 255 - a;
+					sum_a += a;
+					sum_u += GF_COL_G(yuv) * a;
+					sum_v += GF_COL_B(yuv) * a;
+					src += 4;
+				}
+			}
+			*p_u = (u8) ((sum_u + 255*n/2) / (255*n));
+			*p_v = (u8) ((sum_v + 255*n/2) / (255*n));
+			*ia_u = *ia_v = (u8) (255 - (sum_a + n/2) / n);
+			p_u += c_pitch;
+			p_v += c_pitch;
+			ia_u += c_pitch;
+			ia_v += c_pitch;
+		}
+	}
+}
+
+static void compositor_burn_blend_line(u8 *dst, const u8 *p, const u8 *ia, u32 count)
+{
+	u32 i=0;
+#ifdef GPAC_HAS_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i round = _mm_set1_epi16(128);
+	for (; i+16<=count; i+=16) {
+		__m128i d = _mm_loadu_si128((const __m128i *) (dst+i));
+		__m128i a = _mm_loadu_si128((const __m128i *) (ia+i));
+		__m128i s = _mm_loadu_si128((const __m128i *) (p+i));
+		__m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi8(a, zero));
+		__m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_unpackhi_epi8(a, zero));
+		//x/255 with rounding: (x + 128 + ((x + 128)>>8)) >> 8
+		lo = _mm_add_epi16(lo, round);
+		hi = _mm_add_epi16(hi, round);
+		lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+		hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+		d = _mm_adds_epu8(_mm_packus_epi16(lo, hi), s);
+		_mm_storeu_si128((__m128i *) (dst+i), d);
+	}
+#endif
+	for (; i<count; i++) {
+		u32 v = dst[i] * ia[i] + 128;
+		v = ((v + (v>>8)) >> 8) + p[i];
+		dst[i] = (v>255) ? 255 : (u8) v;
+	}
+}
+
+//create output packet for burn-in mode
+static GF_FilterPacket *compositor_burn_frame(GF_Compositor *compositor)
+{
+	u8 *data;
+	u32 i, j, size;
+	GF_PixelPlanes layout;
+	GF_FilterPacket *pck;
+	GF_TextureHandler *txh = compositor->passthrough_txh;
+	GF_FilterPacket *src = txh->stream->pck;
+	Bool is_ifce = gf_filter_pck_get_frame_interface(src) ? GF_TRUE : GF_FALSE;
+
+	if (compositor->burn_dirty) {
+		compositor_burn_build_cache(compositor, txh->pixelformat);
+		compositor->burn_dirty = GF_FALSE;
+	}
+
+	//no overlay, forward input frame
+	if (!compositor->burn_rc.width || !compositor->burn_rc.height) {
+		pck = gf_filter_pck_new_ref(compositor->vout, 0, 0, src);
+		if (pck) gf_filter_pck_merge_properties(src, pck);
+		return pck;
+	}
+
+	data = NULL;
+	pck = gf_filter_pck_new_clone(compositor->vout, src, &data);
+	if (!pck) return NULL;
+
+	gf_filter_pck_get_data(pck, &size);
+	if (!data || !gf_pixel_get_planes(txh->pixelformat, txh->width, txh->height, is_ifce ? 0 : txh->stride, is_ifce ? 0 : txh->stride_chroma, &layout)
+		|| (layout.size > size) || (layout.nb_planes < compositor->burn_nb_planes)
+	) {
+		GF_LOG(GF_LOG_WARNING, GF_LOG_COMPOSE, ("[Compositor] Cannot blend overlay on frame, forwarding frame as is\n"));
+		return pck;
+	}
+
+	for (i=0; i<compositor->burn_nb_planes; i++) {
+		u32 pw = compositor->burn_pw[i];
+		u32 ph = compositor->burn_ph[i];
+		u8 *dst = data + layout.offset[i] + compositor->burn_py[i] * layout.stride[i] + compositor->burn_px[i];
+		const u8 *p = compositor->burn_cache + compositor->burn_poff[i];
+		const u8 *ia = p + pw*ph;
+		for (j=0; j<ph; j++) {
+			compositor_burn_blend_line(dst, p, ia, pw);
+			dst += layout.stride[i];
+			p += pw;
+			ia += pw;
+		}
+	}
+	return pck;
+}
+
 void gf_sc_setup_passthrough(GF_Compositor *compositor)
 {
 	u32 timescale;
 	Bool is_raw_out = GF_FALSE;
+	Bool burn_active;
 	u32 update_pfmt = 0;
 	compositor->passthrough_inplace = GF_FALSE;
 
 	if (!compositor->passthrough_txh) {
 		compositor->passthrough_timescale = 0;
+		compositor->burn_active = GF_FALSE;
 		return;
 	}
 
@@ -599,6 +915,35 @@ void gf_sc_setup_passthrough(GF_Compositor *compositor)
 			}
 		}
 	}
+
+	//burn-in on main video of dynamic scene, only if no output format change
+	burn_active = GF_FALSE;
+	if (compositor->burnin && is_raw_out && (gf_node_get_tag(compositor->passthrough_txh->owner)==TAG_MPEG4_MovieTexture)
+		&& (compositor->passthrough_txh->width==compositor->display_width) && (compositor->passthrough_txh->height==compositor->display_height)
+		&& (!compositor->opfmt || (compositor->opfmt == compositor->passthrough_txh->pixelformat))
+		&& compositor_burn_pfmt_supported(compositor->passthrough_txh->pixelformat)
+	) {
+		u32 size = 4 * compositor->display_width * compositor->display_height;
+		if (size > compositor->burn_buffer_alloc) {
+			compositor->burn_buffer = gf_realloc(compositor->burn_buffer, size);
+			compositor->burn_buffer_alloc = compositor->burn_buffer ? size : 0;
+		}
+		if (compositor->burn_buffer) {
+			if (compositor->burn_buffer_size != size) {
+				compositor->burn_buffer_size = size;
+				memset(compositor->burn_buffer, 0, size);
+				compositor->traverse_state->invalidate_all = GF_TRUE;
+				compositor->burn_dirty = GF_TRUE;
+			}
+			burn_active = GF_TRUE;
+		}
+	}
+	if (burn_active != compositor->burn_active) {
+		GF_LOG(GF_LOG_INFO, GF_LOG_COMPOSE, ("[Compositor] %s overlay burn-in\n", burn_active ? "Enabling" : "Disabling"));
+		compositor->burn_active = burn_active;
+		compositor->traverse_state->invalidate_all = GF_TRUE;
+		compositor->burn_dirty = GF_TRUE;
+	}
 }
 
 static GF_Err gf_sc_load_driver(GF_Compositor *compositor)
@@ -1024,6 +1369,8 @@ void gf_sc_unload(GF_Compositor *compositor)
 	if (compositor->line_buffer) gf_free(compositor->line_buffer);
 #endif
 	if (compositor->framebuffer) gf_free(compositor->framebuffer);
+	if (compositor->burn_buffer) gf_free(compositor->burn_buffer);
+	if (compositor->burn_cache) gf_free(compositor->burn_cache);
 
 	GF_LOG(GF_LOG_DEBUG, GF_LOG_COMPOSE, ("[Compositor] Unloading visual compositor module\n"));
 
@@ -2459,10 +2806,16 @@ static Bool gf_sc_draw_scene(GF_Compositor *compositor)
 		}
 		if (compositor->passthrough_txh) {
 			gf_sc_setup_passthrough(compositor);
-			compositor->traverse_state->immediate_draw = 1;
+			//in burn-in mode, overlay is drawn in dirty-rect mode and only redrawn upon changes
+			compositor->traverse_state->immediate_draw = compositor->burn_active ? 0 : 1;
+		} else {
+			compositor->burn_active = GF_FALSE;
 		}
 
-		if (! visual_draw_frame(compositor->visual, top_node, compositor->traverse_state, 1)) {
+		if (visual_draw_frame(compositor->visual, top_node, compositor->traverse_state, 1)) {
+			if (compositor->burn_active)
+				compositor->burn_dirty = GF_TRUE;
+		} else {
 			/*android backend uses opengl without telling it to us, we need an ugly hack here ...*/
 #ifdef GPAC_CONFIG_ANDROID
 			compositor->skip_flush = 0;
@@ -2971,7 +3324,8 @@ void gf_sc_render_frame(GF_Compositor *compositor)
 			}
 			else if (!scene_drawn)
 				emit_frame = GF_FALSE;
-			else if (compositor->frame_draw_type)
+			//in burn-in mode, the frame is emitted with the overlay as drawn, changes raised during draw go to next frame
+			else if (compositor->frame_draw_type && !compositor->burn_active)
 				emit_frame = GF_FALSE;
 			else if (compositor->fonts_pending>0)
 				emit_frame = GF_FALSE;
@@ -3001,7 +3355,16 @@ void gf_sc_render_frame(GF_Compositor *compositor)
 			u64 pck_frame_ts=0;
 			GF_FilterPacket *pck;
 			frame_ts = 0;
-			if (compositor->passthrough_pck) {
+			if (compositor->burn_active) {
+				pck = compositor_burn_frame(compositor);
+				if (!pck) {
+					GF_LOG(GF_LOG_ERROR, GF_LOG_COMPOSE, ("[Compositor] Failed to allocate output video packet\n"));
+					compositor_release_textures(compositor, frame_drawn);
+					gf_sc_lock(compositor, 0);
+					return;
+				}
+				pck_frame_ts = gf_filter_pck_get_cts(pck);
+			} else if (compositor->passthrough_pck) {
 				pck = compositor->passthrough_pck;
 				compositor->passthrough_pck = NULL;
 				pck_frame_ts = gf_filter_pck_get_cts(pck);
@@ -3224,7 +3587,8 @@ void gf_sc_render_frame(GF_Compositor *compositor)
 
 		if (!compositor->player) {
 			//if systems frames are pending (not executed because too early), increase clock
-			if ((compositor->sys_frames_pending && (compositor->ms_until_next_frame>=0) )
+			//unless clock is driven by passthrough texture in burn-in mode
+			if ((compositor->sys_frames_pending && (compositor->ms_until_next_frame>=0) && !(compositor->burn_active && compositor->passthrough_txh))
 			//if timed nodes or validator mode (which acts as a timed node firing events), increase scene clock
 			//in vfr mode
 			|| (compositor->vfr && (has_timed_nodes || compositor->validator_mode) )
@@ -3239,6 +3603,10 @@ void gf_sc_render_frame(GF_Compositor *compositor)
 				gf_assert(res >= compositor->scene_sampled_clock);
 				compositor->scene_sampled_clock = (u32) res;
 			}
+			//burn-in clock driven by passthrough texture, pending systems frames will be executed when the clock reaches them
+			else if (compositor->burn_active && compositor->passthrough_txh) {
+				compositor->sys_frames_pending = GF_FALSE;
+			}
 
 			if (all_tx_done && !has_timed_nodes) {
 				//we were in eos, notify we are done
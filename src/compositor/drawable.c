@@ -845,6 +845,15 @@ static Bool drawable_finalize_end(struct _drawable_context *ctx, GF_TraverseStat
 
 		return res;
 	}
+	/*burn-in mode, the passthrough video is blended at output and never drawn on the overlay*/
+	if (tr_state->visual->compositor->burn_active && ctx->aspect.fill_texture
+		&& (ctx->aspect.fill_texture == tr_state->visual->compositor->passthrough_txh)
+		&& (tr_state->visual == tr_state->visual->compositor->visual)
+	) {
+		ctx->bi->clip.width = 0;
+		if (tr_state->visual->cur_context == ctx) tr_state->visual->cur_context->drawable = NULL;
+		return res;
+	}
 	if (tr_state->visual->compositor->clipframe)
 		gf_irect_union(&tr_state->visual->frame_bounds, &ctx->bi->clip);
 
@@ -97,6 +97,17 @@ static void movietexture_update(GF_TextureHandler *txh)
 	/*when fetching the first frame disable resync*/
 	gf_sc_texture_update_frame(txh, 0);
 
+	/*burn-in mode: the main video of a dynamic scene is used as passthrough*/
+	if (txh->compositor->burnin && !txh->compositor->player && !txh->compositor->passthrough_txh && txh->stream && txh->stream->odm
+		&& txh->stream->odm->parentscene && txh->stream->odm->parentscene->is_dynamic_scene && !txh->stream->odm->parentscene->root_od->parentscene
+	) {
+		const char *name = gf_node_get_name(txh->owner);
+		if (name && !strcmp(name, "DYN_VIDEO1")) {
+			if (!txh->width || ((txh->width==txh->compositor->display_width) && (txh->height==txh->compositor->display_height)))
+				txh->compositor->passthrough_txh = txh;
+		}
+	}
+
 	if (txh->stream_finished) {
 		if (movietexture_get_loop(st, txnode)) {
 			gf_sc_texture_restart(txh);
@@ -1649,7 +1649,7 @@ void gf_scene_regenerate(GF_Scene *scene)
 		gf_node_register(n1, NULL);
 		root = n1;
 
-		if (! scene->root_od->parentscene && !scene->compositor->forced_alpha) {
+		if (! scene->root_od->parentscene && !scene->compositor->forced_alpha && !scene->compositor->burnin) {
 			n2 = is_create_node(scene->graph, TAG_MPEG4_Background2D, "DYN_BACK");
 			gf_node_list_add_child( &((GF_ParentNode *)n1)->children, n2);
 			gf_node_register(n2, n1);
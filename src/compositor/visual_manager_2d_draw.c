@@ -56,7 +56,7 @@ void visual_2d_clear_surface(GF_VisualManager *visual, GF_IRect *rc, u32 BackCol
 #endif
 	if (! visual->CheckAttached(visual) ) return;
 
-	if (!BackColor && !visual->offscreen && !visual->compositor->forced_alpha) {
+	if (!BackColor && !visual->offscreen && !visual->compositor->forced_alpha && !visual->compositor->burn_active) {
 		if ( !(visual->compositor->init_flags & GF_VOUT_WINDOW_TRANSPARENT)) {
 			BackColor = visual->compositor->back_color;
 		}
@@ -166,6 +166,9 @@
 #pragma comment (linker, EXPORT_SYMBOL(gf_gz_compress_payload_ex) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_gz_decompress_payload) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_gz_decompress_payload_ex) )
+#pragma comment (linker, EXPORT_SYMBOL(gf_gz_compressor_new) )
+#pragma comment (linker, EXPORT_SYMBOL(gf_gz_compressor_del) )
+#pragma comment (linker, EXPORT_SYMBOL(gf_gz_compressor_process) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_lz_compress_payload) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_lz_decompress_payload) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_file_handles_count) )
@@ -1056,6 +1059,7 @@
 #pragma comment (linker, EXPORT_SYMBOL(gf_isom_set_final_name) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_isom_set_storage_mode) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_isom_enable_compression) )
+#pragma comment (linker, EXPORT_SYMBOL(gf_isom_set_compression_level) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_isom_force_64bit_chunk_offset) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_isom_set_interleave_time) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_isom_set_copyright) )
@@ -1263,6 +1267,9 @@
 #pragma comment (linker, EXPORT_SYMBOL(gf_rtp_streamer_send_rtcp) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_rtp_streamer_get_payload_type) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_rtp_streamer_set_interleave_callbacks) )
+#pragma comment (linker, EXPORT_SYMBOL(gf_rtp_streamer_add_mirror) )
+#pragma comment (linker, EXPORT_SYMBOL(gf_rtp_streamer_remove_mirror) )
+#pragma comment (linker, EXPORT_SYMBOL(gf_rtp_streamer_mute) )
 
 #endif
 
@@ -2115,6 +2122,8 @@
 #pragma comment (linker, EXPORT_SYMBOL(gf_mpd_init_smooth_from_dom) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_mpd_complete_from_dom) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_mpd_get_segment_start_time_with_timescale) )
+#pragma comment (linker, EXPORT_SYMBOL(gf_mpd_segment_timeline_get_segment) )
+#pragma comment (linker, EXPORT_SYMBOL(gf_mpd_segment_timeline_find_segment) )
 
 
 #endif /*GPAC_DISABLE_MPEG2TS*/
@@ -2308,6 +2317,7 @@
 #pragma comment (linker, EXPORT_SYMBOL(gf_route_dmx_del) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_route_atsc3_tune_in) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_route_dmx_process) )
+#pragma comment (linker, EXPORT_SYMBOL(gf_route_dmx_set_threads) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_route_dmx_get_object_count) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_route_dmx_remove_object_by_name) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_route_dmx_remove_first_object) )
@@ -2365,6 +2375,9 @@
 #pragma comment (linker, EXPORT_SYMBOL(gf_pixel_fmt_all_names) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_pixel_fmt_all_shortnames) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_pixel_get_size_info) )
+#pragma comment (linker, EXPORT_SYMBOL(gf_pixel_get_planes) )
+#pragma comment (linker, EXPORT_SYMBOL(gf_pixel_copy_plane) )
+#pragma comment (linker, EXPORT_SYMBOL(gf_pixel_copy_frame) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_pixel_fmt_enum) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_pixel_get_bytes_per_pixel) )
 #pragma comment (linker, EXPORT_SYMBOL(gf_pixel_fmt_name) )
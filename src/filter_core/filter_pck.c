@@ -239,8 +239,11 @@ static GF_FilterPacket *gf_filter_pck_new_dangling_packet(GF_FilterPacket *cache
 
 static GF_FilterPacket *gf_filter_pck_clone_frame_interface(GF_FilterPid *pid, GF_FilterPacket *pck_source, u8 **data, Bool dangling_packet, GF_FilterPacket *cached_pck)
 {
-	u32 i, w, h, stride, stride_uv, pf, osize;
-	u32 nb_planes, uv_height;
+	u32 i, w, h, pf;
+	GF_PixelPlanes layout;
+	u8 *dst_planes[4];
+	const u8 *src_planes[4];
+	u32 src_strides[4];
 	GF_FilterPacket *dst, *ref;
 	u8 *pck_data;
 	GF_FilterPacketInstance *pcki = (GF_FilterPacketInstance *) pck_source;
@@ -261,23 +264,21 @@ static GF_FilterPacket *gf_filter_pck_clone_frame_interface(GF_FilterPid *pid, G
 		GF_LOG(GF_LOG_ERROR, GF_LOG_FILTER, ("Missing width/height/pf in frame interface cloning, not supported\n"));
 		return NULL;
 	}
-	stride = stride_uv = 0;
-
-	if (gf_pixel_get_size_info(pf, w, h, &osize, &stride, &stride_uv, &nb_planes, &uv_height) == GF_FALSE) {
+	if (gf_pixel_get_planes(pf, w, h, 0, 0, &layout) == GF_FALSE) {
 		GF_LOG(GF_LOG_ERROR, GF_LOG_FILTER, ("Unknown pixel format, cannot grab underlying video data\n"));
 		return NULL;
 	}
 
 	if (!dangling_packet) {
 		p = gf_filter_pid_get_property(pid, GF_PROP_PID_STRIDE);
-		if (!p || (p->value.uint != stride)) {
-			gf_filter_pid_set_property(pid, GF_PROP_PID_STRIDE, &PROP_UINT(stride));
-			gf_filter_pid_set_property(pid, GF_PROP_PID_STRIDE_UV, &PROP_UINT(stride_uv));
+		if (!p || (p->value.uint != layout.stride[0])) {
+			gf_filter_pid_set_property(pid, GF_PROP_PID_STRIDE, &PROP_UINT(layout.stride[0]));
+			gf_filter_pid_set_property(pid, GF_PROP_PID_STRIDE_UV, &PROP_UINT(layout.stride[1]));
 		}
-		dst = gf_filter_pck_new_alloc(pid, osize, &pck_data);
+		dst = gf_filter_pck_new_alloc(pid, layout.size, &pck_data);
 		if (!dst) return NULL;
 	} else {
-		dst = gf_filter_pck_new_dangling_packet(cached_pck, osize);
+		dst = gf_filter_pck_new_dangling_packet(cached_pck, layout.size);
 		if (!dst) return NULL;
 		pck_data = dst->data;
 	}
@@ -285,28 +286,18 @@ static GF_FilterPacket *gf_filter_pck_clone_frame_interface(GF_FilterPid *pid, G
 	if (!dst) return NULL;
 	if (data) *data = pck_data;
 
-	for (i=0; i<nb_planes; i++) {
-		u32 j, write_h, dst_stride;
-		const u8 *in_ptr;
-		u32 src_stride = i ? stride_uv : stride;
-		GF_Err e = ref->frame_ifce->get_plane(ref->frame_ifce, i, &in_ptr, &src_stride);
+	for (i=0; i<layout.nb_planes; i++) {
+		src_strides[i] = layout.stride[i];
+		GF_Err e = ref->frame_ifce->get_plane(ref->frame_ifce, i, &src_planes[i], &src_strides[i]);
 		if (e) {
 			GF_LOG(GF_LOG_ERROR, GF_LOG_FILTER, ("Failed to fetch plane data from hardware frame, cannot clone\n"));
 			break;
 		}
-		if (i) {
-			write_h = uv_height;
-			dst_stride = stride_uv;
-		} else {
-			write_h = h;
-			dst_stride = stride;
-		}
-		for (j=0; j<write_h; j++) {
-			memcpy(pck_data, in_ptr, dst_stride);
-			in_ptr += src_stride;
-			pck_data += dst_stride;
-		}
+		dst_planes[i] = pck_data + layout.offset[i];
 	}
+	//only copy planes fetched
+	layout.nb_planes = i;
+	gf_pixel_copy_frame(&layout, dst_planes, NULL, src_planes, src_strides);
 	gf_filter_pck_merge_properties(pck_source, dst);
 	return dst;
 }
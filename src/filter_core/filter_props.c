@@ -1656,6 +1656,7 @@ GF_BuiltInProperty GF_BuiltInProps [] =
 	"- 2: a clear clone of the sample description is created, inserted after the CENC sample description", GF_PROP_UINT),
 	DEC_PROP( GF_PROP_PID_AMR_MODE_SET, "AMRModeSet", "ModeSet for AMR and AMR-WideBand", GF_PROP_UINT),
 	DEC_PROP( GF_PROP_PCK_SUBS, "SubSampleInfo", "Binary blob describing N subsamples of the sample, formatted as N [(u32)flags(u32)size(u32)codec_param(u8)priority(u8) discardable]. Subsamples for a given flag MUST appear in order, however flags can be interleaved", GF_PROP_DATA),
+	DEC_PROP_F( GF_PROP_PCK_NALU_HDRS, "NALUHeaders", "List of (NAL size, clear bytes) pairs for each NAL unit of the sample, in order. Clear bytes is the size of the slice header (including NAL header) for slice NAL units, or the NAL size otherwise", GF_PROP_UINT_LIST, GF_PROP_FLAG_PCK),
 	DEC_PROP( GF_PROP_PID_MAX_NALU_SIZE, "NALUMaxSize", "Max size of NAL units in stream - changes are signaled through PID info change (no reconfigure)", GF_PROP_UINT),
 	DEC_PROP_F( GF_PROP_PCK_FILENUM, "FileNumber", "Index of file when dumping to files", GF_PROP_UINT, GF_PROP_FLAG_PCK),
 	DEC_PROP_F( GF_PROP_PCK_FILENAME, "FileName", "Name of output file when dumping / dashing. Must be set on first packet belonging to new file", GF_PROP_STRING, GF_PROP_FLAG_PCK),
@@ -108,6 +108,12 @@ static GF_Err compose_process(GF_Filter *filter)
 		}
 	}
 
+	//in burn-in mode, wait for all inputs before producing the first frame so that the main video is known
+	if (ctx->burnin && !ctx->player && !ctx->frame_number && gf_filter_connections_pending(filter)) {
+		gf_filter_ask_rt_reschedule(filter, 1000);
+		return GF_OK;
+	}
+
 	ret = gf_sc_draw_frame(ctx, GF_FALSE, &ms_until_next);
 
 	if (!ctx->player) {
@@ -1132,6 +1138,7 @@ static GF_FilterArgs CompositorArgs[] =
 	{ OFFS(subty), "vertical translation in pixels towards top for subtitles renderers", GF_PROP_SINT, "0", NULL, GF_FS_ARG_HINT_EXPERT|GF_FS_ARG_UPDATE},
 	{ OFFS(subfs), "font size for subtitles renderers (0 means automatic)", GF_PROP_UINT, "0", NULL, GF_FS_ARG_HINT_EXPERT|GF_FS_ARG_UPDATE},
 	{ OFFS(subd), "subtitle delay in milliseconds for subtitles renderers", GF_PROP_SINT, "0", NULL, GF_FS_ARG_HINT_EXPERT|GF_FS_ARG_UPDATE},
+	{ OFFS(burnin), "burn overlays (subtitles, text) on video using cached overlay bitmap, see filter help", GF_PROP_BOOL, "false", NULL, GF_FS_ARG_HINT_EXPERT},
 	{ OFFS(audd), "audio delay in milliseconds", GF_PROP_SINT, "0", NULL, GF_FS_ARG_HINT_EXPERT|GF_FS_ARG_UPDATE},
 	{ OFFS(clipframe), "visual output is clipped to bounding rectangle", GF_PROP_BOOL, "false", NULL, GF_FS_ARG_HINT_EXPERT},
 	{0}
@@ -1192,6 +1199,13 @@ const GF_FilterRegister CompositorFilterRegister = {
 	"\n"
 	"If 3D graphics are used or display driver is forced, OpenGL will be used on offscreen surface and the output packet will be an OpenGL texture.\n"
 	"\n"
+	"# Burn-in mode\n"
+	"When [-burnin]() is set and the compositor renders a video with text or subtitle streams without scene description, the video PID is used in pass-through mode.\n"
+	"Overlays are rasterized in a transparent canvas only when they change, and cached premultiplied in the output pixel format.\n"
+	"Each video frame is then either forwarded by reference if no overlay is active, or copied and blended with the cached overlay over the covered area only.\n"
+	"This mode is only used when the video size matches the output size, and for 8-bit RGB and YUV (planar or semi-planar) pixel formats.\n"
+	"EX gpac -i video.mp4 -i subs.srt compositor:burnin -o res.mp4\n"
+	"\n"
 	"# Specific URL syntaxes\n"
 	"The compositor accepts any URL type supported by GPAC. It also accepts the following schemes for URLs:\n"
 	"- views:// : creates an auto-stereo scene of N views from `views://v1::.::vN`\n"
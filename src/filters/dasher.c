@@ -219,11 +219,12 @@ typedef struct
 	Bool hlsiv;
 	//inherited from mp4mx
 	GF_Fraction cdur;
-	Bool ll_preload_hint, ll_rend_rep;
+	Bool ll_preload_hint, ll_rend_rep, ll_sync;
 	Bool gencues, force_init, gxns;
 	Double ll_part_hb;
 	u32 hls_absu, seg_sync;
 	Bool hls_ap;
+	Bool srcsegs;
 
 	//internal
 	Bool in_error;
@@ -3406,6 +3407,83 @@ static void dasher_update_dep_list(GF_DasherCtx *ctx, GF_DashStream *ds, const c
 	}
 }
 
+#ifndef GPAC_DISABLE_ISOM
+//the file path property is forwarded by all filters, only trust it if the PID is directly produced by the ISOBMFF demuxer
+//of that file, so that packets match the sample table (no transcoding, reframing or timing change)
+static Bool dasher_pid_from_isom_source(GF_DashStream *ds)
+{
+	const char *fname = gf_filter_pid_get_filter_name(ds->ipid);
+	return (fname && !strcmp(fname, "mp4dmx")) ? GF_TRUE : GF_FALSE;
+}
+
+//computes an upper bound of the number of segments of an onDemand representation from the sample table of the
+//source file, if local and non-fragmented. This allows the muxer to reserve the exact sidx space and write the file once
+static u32 dasher_get_source_segment_count(GF_DasherCtx *ctx, GF_DashStream *ds)
+{
+	u32 i, track, nb_samples, timescale, nb_segs;
+	u64 first_cts=0, max_k=0;
+	GF_ISOSample *samp;
+	GF_ISOFile *file;
+	const GF_PropertyValue *p;
+	GF_DashStream *base_ds = ds->muxed_base ? ds->muxed_base : ds;
+
+	if (!ctx->srcsegs || !ctx->sseg || !ctx->sap || ctx->loop || ctx->subdur || ctx->sigfrag) return 0;
+	if ((ds->sbound!=DASHER_BOUNDS_OUT) || ds->splitable || !ds->is_av) return 0;
+	if (!ds->dash_dur.num || !ds->dash_dur.den) return 0;
+
+	//the muxer uses the largest count of all its inputs, all streams of the representation must come from the source file
+	for (i=0; i<gf_list_count(ctx->pids); i++) {
+		GF_DashStream *a_ds = gf_list_get(ctx->pids, i);
+		if ((a_ds != base_ds) && (a_ds->muxed_base != base_ds)) continue;
+		if (!dasher_pid_from_isom_source(a_ds)) return 0;
+	}
+
+	p = gf_filter_pid_get_property(ds->ipid, GF_PROP_PID_FILEPATH);
+	if (!p || !p->value.string || !gf_file_exists(p->value.string)) return 0;
+	if (!gf_isom_probe_file(p->value.string)) return 0;
+
+	file = gf_isom_open(p->value.string, GF_ISOM_OPEN_READ, NULL);
+	if (!file) return 0;
+	nb_segs = 0;
+	track = gf_isom_get_track_by_id(file, ds->id);
+	nb_samples = track ? gf_isom_get_sample_count(file, track) : 0;
+	timescale = track ? gf_isom_get_media_timescale(file, track) : 0;
+	//samples in fragments are not in the sample table, and source must match the PID
+	if (!nb_samples || !timescale || gf_isom_is_fragmented(file)
+		|| (ds->nb_samples_in_source && (nb_samples != ds->nb_samples_in_source))
+	) {
+		gf_isom_close(file);
+		return 0;
+	}
+
+	samp = gf_isom_sample_new();
+	//a new segment may only start on a SAP lying in a new segment interval, count distinct intervals holding a SAP
+	for (i=0; i<nb_samples; i++) {
+		u64 cts, k;
+		if (!gf_isom_get_sample_sync(file, track, i+1)) continue;
+		if (!gf_isom_get_sample_info_ex(file, track, i+1, NULL, NULL, samp)) break;
+		cts = samp->DTS + samp->CTS_Offset;
+		if (!nb_segs) {
+			first_cts = cts;
+			nb_segs = 1;
+			continue;
+		}
+		if (cts < first_cts) continue;
+		k = gf_timestamp_rescale(cts - first_cts, timescale, 1000000) * ds->dash_dur.den / ds->dash_dur.num / 1000000;
+		if (k > max_k) {
+			max_k = k;
+			nb_segs++;
+		}
+	}
+	gf_isom_sample_del(&samp);
+	gf_isom_close(file);
+	//account for timestamp shifts (edits, delays) moving one SAP across a boundary
+	if (nb_segs) nb_segs++;
+	GF_LOG(GF_LOG_DEBUG, GF_LOG_DASH, ("[Dasher] Source %s track %d: at most %d segments\n", p->value.string, ds->id, nb_segs));
+	return nb_segs;
+}
+#endif
+
 static void dasher_open_pid(GF_Filter *filter, GF_DasherCtx *ctx, GF_DashStream *ds, GF_List *multi_pids, Bool init_trashed)
 {
 	GF_DashStream *base_ds = ds->muxed_base ? ds->muxed_base : ds;
@@ -3480,6 +3558,13 @@ static void dasher_open_pid(GF_Filter *filter, GF_DasherCtx *ctx, GF_DashStream
 			ncues++;
 		gf_filter_pid_set_property(ds->opid, GF_PROP_PID_DASH_SEGMENTS, &PROP_UINT(ncues) );
 	}
+#ifndef GPAC_DISABLE_ISOM
+	else if (!ds->inband_cues) {
+		u32 nb_segs = dasher_get_source_segment_count(ctx, ds);
+		if (nb_segs)
+			gf_filter_pid_set_property(ds->opid, GF_PROP_PID_DASH_SEGMENTS, &PROP_UINT(nb_segs) );
+	}
+#endif
 	//for route out
 	if (ctx->do_m3u8)
 		gf_filter_pid_set_property(ds->opid, GF_PROP_PCK_HLS_REF, &PROP_LONGUINT( ds->hls_ref_id ) );
@@ -10029,6 +10114,26 @@ static void dasher_resume_subdur(GF_Filter *filter, GF_DasherCtx *ctx)
 	gf_filter_post_process_task(filter);
 }
 
+//check if the part just produced for this segment state completes a part boundary across all LL-HLS streams of the period
+static Bool dasher_hls_ll_part_boundary(GF_DasherCtx *ctx, GF_DashStream *ds, GF_DASH_SegmentContext *sctx)
+{
+	u32 i, count = gf_list_count(ctx->current_period->streams);
+	for (i=0; i<count; i++) {
+		GF_DASH_SegmentContext *a_sctx;
+		GF_DashStream *a_ds = gf_list_get(ctx->current_period->streams, i);
+		if ((a_ds==ds) || a_ds->muxed_base || a_ds->done) continue;
+		a_sctx = gf_list_get(a_ds->pending_segment_states, 0);
+		if (!a_sctx || !a_sctx->llhls_mode || a_sctx->llhls_done) continue;
+		//not in the same segment, don't wait
+		if (a_sctx->seg_num != sctx->seg_num) continue;
+		//stream lagging by more than one part, don't wait
+		if (a_sctx->nb_frags + 1 < sctx->nb_frags) continue;
+		//stream will produce this part soon, playlist update will be done then
+		if (a_sctx->nb_frags < sctx->nb_frags) return GF_FALSE;
+	}
+	return GF_TRUE;
+}
+
 static void dasher_process_hls_ll(GF_DasherCtx *ctx, const GF_FilterEvent *evt)
 {
 	u32 i, count = gf_list_count(ctx->pids);
@@ -10076,7 +10181,7 @@ static void dasher_process_hls_ll(GF_DasherCtx *ctx, const GF_FilterEvent *evt)
 	sctx->nb_frags++;
 	if (evt->frag_size.is_last) {
 		sctx->llhls_done = GF_TRUE;
-	} else {
+	} else if (!ctx->ll_sync || dasher_hls_ll_part_boundary(ctx, ds, sctx)) {
 		ctx->force_hls_ll_manifest = GF_TRUE;
 	}
 }
@@ -10765,7 +10870,9 @@ static const GF_FilterArgs DasherArgs[] =
 	{ OFFS(hlsiv), "inject IV in variant HLS playlist`", GF_PROP_BOOL, "true", NULL, GF_FS_ARG_HINT_EXPERT},
 	{ OFFS(ll_preload_hint), "inject preload hint for LL-HLS", GF_PROP_BOOL, "true", NULL, GF_FS_ARG_HINT_EXPERT},
 	{ OFFS(ll_rend_rep), "inject rendition reports for LL-HLS", GF_PROP_BOOL, "true", NULL, GF_FS_ARG_HINT_EXPERT},
+	{ OFFS(ll_sync), "coalesce LL-HLS playlist updates across representations, only updating playlists once all representations have produced the current part or when one representation is more than one part ahead", GF_PROP_BOOL, "true", NULL, GF_FS_ARG_HINT_EXPERT},
 	{ OFFS(ll_part_hb), "user-defined part hold-back for LLHLS, negative value means 3 times max part duration in session", GF_PROP_DOUBLE, "-1", NULL, GF_FS_ARG_HINT_EXPERT},
+	{ OFFS(srcsegs), "in onDemand mode, compute the number of segments from the sample table of local ISOBMFF sources so that the muxer reserves the exact index size and writes the file in a single pass", GF_PROP_BOOL, "true", NULL, GF_FS_ARG_HINT_EXPERT},
 	{ OFFS(ckurl), "set the ClearKey URL common to all encrypted streams (overriden by `CKUrl` pid property)", GF_PROP_STRING, NULL, NULL, GF_FS_ARG_HINT_EXPERT},
 
 	{ OFFS(hls_absu), "use absolute url in HLS generation using first URL in [base]()\n"
@@ -53,7 +53,7 @@ enum
 typedef struct
 {
 	u8 *data;
-	u32 size;
+	u32 size, alloc_size;
 	Bool is_m2v;
 	u64 timestamp;
 } CCItem;
@@ -64,7 +64,12 @@ typedef struct
 	GF_FilterPid *opid;
 	u32 cctype;
 	u32 nalu_size_len;
-	GF_List *cc_queue;
+	//ring buffer of CC items sorted by timestamp, slot data buffers are reused
+	CCItem *cc_queue;
+	u32 cc_alloc, cc_first, cc_count;
+	//SEI payload without emulation prevention bytes
+	u8 *sei_buf;
+	u32 sei_buf_size;
 
 	u32 timescale;
 #ifdef GPAC_HAS_LIBCAPTION
@@ -187,8 +192,11 @@ void gf_m4v_parser_set_inspect(GF_M4VParser *m4v);
 
 static GF_Err ccdec_flush_queue(CCDecCtx *ctx)
 {
-	CCItem *cc = gf_list_pop_front(ctx->cc_queue);
-	if (!cc) return GF_EOS;
+	CCItem *cc;
+	if (!ctx->cc_count) return GF_EOS;
+	cc = &ctx->cc_queue[ctx->cc_first];
+	ctx->cc_first = (ctx->cc_first + 1) % ctx->cc_alloc;
+	ctx->cc_count--;
 
 	cea708_t scc;
 	cea708_init(&scc, 0);
@@ -224,9 +232,6 @@ static GF_Err ccdec_flush_queue(CCDecCtx *ctx)
 			}
 		}
 	}
-	gf_free(cc->data);
-	gf_free(cc);
-
 	if (!dump_frame) return GF_OK;
 
 	u8 txtdata[CAPTION_FRAME_TEXT_BYTES+1];
@@ -257,12 +262,13 @@ static GF_Err ccdec_flush_queue(CCDecCtx *ctx)
 	return GF_OK;
 }
 
-static GF_Err ccdec_queue_data(CCDecCtx *ctx, u64 ts, u8 *data, u32 max_size, Bool m2v, Bool keep_data)
+#define CC_SLOT(_ctx, _idx) (&(_ctx)->cc_queue[((_ctx)->cc_first + (_idx)) % (_ctx)->cc_alloc])
+
+static GF_Err ccdec_queue_data(CCDecCtx *ctx, u64 ts, u8 *data, u32 max_size, Bool m2v)
 {
 	//for m2v, check if the udta is indeed a CC
 	if (m2v) {
 		if (max_size<7) {
-			if (keep_data) gf_free(data);
 			return GF_OK;
 		}
 		u32 udta_id = GF_4CC(data[0], data[1], data[2], data[3]);
@@ -276,7 +282,6 @@ static GF_Err ccdec_queue_data(CCDecCtx *ctx, u64 ts, u8 *data, u32 max_size, Bo
 			u32 cc_count = (data[5] & 0x1F);
 			cc_count *= 3;
 			if (max_size<7+cc_count) {
-				if (keep_data) gf_free(data);
 				return GF_OK;
 			}
 			max_size = 7+cc_count;
@@ -284,42 +289,104 @@ static GF_Err ccdec_queue_data(CCDecCtx *ctx, u64 ts, u8 *data, u32 max_size, Bo
 	}
 	//otherwise check was done in sei / OBU Metadata parsing
 
-	CCItem *it;
-	GF_SAFEALLOC(it, CCItem);
-	if (!it) {
-		if (keep_data) gf_free(data);
-		return GF_OUT_OF_MEM;
+	if (ctx->cc_count == ctx->cc_alloc) {
+		//linearize and double the ring, keeping all slot buffers
+		u32 i, new_alloc = ctx->cc_alloc ? 2*ctx->cc_alloc : 8;
+		CCItem *items = gf_malloc(sizeof(CCItem) * new_alloc);
+		if (!items) return GF_OUT_OF_MEM;
+		for (i=0; i<ctx->cc_alloc; i++) {
+			items[i] = *CC_SLOT(ctx, i);
+		}
+		memset(items + ctx->cc_alloc, 0, sizeof(CCItem) * (new_alloc - ctx->cc_alloc));
+		if (ctx->cc_queue) gf_free(ctx->cc_queue);
+		ctx->cc_queue = items;
+		ctx->cc_alloc = new_alloc;
+		ctx->cc_first = 0;
 	}
-	if (!keep_data) {
-		it->data = gf_malloc(sizeof(u8)*max_size);
-		if (!it->data) return GF_OUT_OF_MEM;
-		memcpy(it->data, data, sizeof(u8)*max_size);
-	} else {
-		it->data = data;
+
+	//queue is sorted, insert after the last item with timestamp lower or equal to ts
+	u32 i, pos = ctx->cc_count;
+	while (pos && (CC_SLOT(ctx, pos-1)->timestamp > ts))
+		pos--;
+
+	//grow the free slot buffer before touching the queue, so that a failure leaves it unchanged
+	CCItem *free_slot = CC_SLOT(ctx, ctx->cc_count);
+	if (free_slot->alloc_size < max_size) {
+		u8 *new_data = gf_realloc(free_slot->data, sizeof(u8)*max_size);
+		if (!new_data) return GF_OUT_OF_MEM;
+		free_slot->data = new_data;
+		free_slot->alloc_size = max_size;
 	}
-	it->size = max_size;
-	it->timestamp = ts;
-	it->is_m2v = m2v;
-	Bool can_flush = GF_FALSE;
-	u32 i, count=gf_list_count(ctx->cc_queue);
-	for (i=0; i<count; i++) {
-		CCItem *an_it = gf_list_get(ctx->cc_queue, i);
-		if (an_it->timestamp > it->timestamp) {
-			gf_list_insert(ctx->cc_queue, it, i);
-			if (i)
-				can_flush = GF_TRUE;
-			it=NULL;
-			break;
+
+	//move the free slot (and its buffer) at insertion point
+	CCItem it = *free_slot;
+	for (i=ctx->cc_count; i>pos; i--) {
+		*CC_SLOT(ctx, i) = *CC_SLOT(ctx, i-1);
+	}
+	memcpy(it.data, data, sizeof(u8)*max_size);
+	it.size = max_size;
+	it.timestamp = ts;
+	it.is_m2v = m2v;
+	*CC_SLOT(ctx, pos) = it;
+	ctx->cc_count++;
+
+	//inserted in the middle of the queue, flush everything before
+	if (pos && (pos+1 < ctx->cc_count)) {
+		while (ctx->cc_count && (CC_SLOT(ctx, 0)->timestamp < ts)) {
+			ccdec_flush_queue(ctx);
 		}
 	}
-	if (it) gf_list_add(ctx->cc_queue, it);
+	return GF_OK;
+}
 
-	while (can_flush) {
-		it = gf_list_get(ctx->cc_queue, 0);
-		if (it->timestamp>=ts) break;
-		ccdec_flush_queue(ctx);
+static void ccdec_parse_sei(CCDecCtx *ctx, u64 ts, const u8 *nal, u32 nal_size, u32 sei_h_size)
+{
+	u32 pos, size;
+	if (nal_size <= sei_h_size) return;
+	if (ctx->sei_buf_size < nal_size) {
+		ctx->sei_buf = gf_realloc(ctx->sei_buf, nal_size);
+		if (!ctx->sei_buf) {
+			ctx->sei_buf_size = 0;
+			return;
+		}
+		ctx->sei_buf_size = nal_size;
+	}
+	//remove emulation prevention bytes once, then walk SEI messages in memory
+	size = gf_media_nalu_remove_emulation_bytes(nal + sei_h_size, ctx->sei_buf, nal_size - sei_h_size);
+	pos = 0;
+	while (pos < size) {
+		u32 sei_type = 0;
+		u32 sei_size = 0;
+		while ((pos < size) && (ctx->sei_buf[pos] == 0xFF)) {
+			sei_type += 255;
+			pos++;
+		}
+		if (pos >= size) break;
+		sei_type += ctx->sei_buf[pos++];
+		while ((pos < size) && (ctx->sei_buf[pos] == 0xFF)) {
+			sei_size += 255;
+			pos++;
+		}
+		if (pos >= size) break;
+		sei_size += ctx->sei_buf[pos++];
+		if (pos + sei_size > size) break;
+
+		if ((sei_type == 4) && (sei_size >= 3)) {
+			const u8 *payload = ctx->sei_buf + pos;
+			u32 hdr_size = (payload[0] == 0xFF) ? 2 : 1;
+			if (sei_size >= hdr_size + 2) {
+				u32 terminal_provider_code = ((u32) payload[hdr_size] << 8) | payload[hdr_size+1];
+				if (terminal_provider_code==GF_ITU_T35_PROVIDER_ATSC) {
+					ccdec_queue_data(ctx, ts, (u8 *) payload, sei_size, GF_FALSE);
+				}
+			}
+		}
+		pos += sei_size;
+		//rbsp trailing bits
+		if ((pos < size) && (ctx->sei_buf[pos] == 0x80)) {
+			break;
+		}
 	}
-	return GF_OK;
 }
 
 
@@ -333,7 +400,7 @@ GF_Err ccdec_process(GF_Filter *filter)
 	GF_FilterPacket *pck = gf_filter_pid_get_packet(ctx->ipid);
 	if (!pck) {
 		if (gf_filter_pid_is_eos(ctx->ipid)) {
-			while (gf_list_count(ctx->cc_queue)) {
+			while (ctx->cc_count) {
 				ccdec_flush_queue(ctx);
 			}
 			gf_filter_pid_set_eos(ctx->opid);
@@ -368,7 +435,7 @@ GF_Err ccdec_process(GF_Filter *filter)
 			if (ctx->cctype==CCTYPE_M4V) {
 				switch (o_type) {
 				case M4V_UDTA_START_CODE:
-					ccdec_queue_data(ctx, ts, (u8*) data + start+4, (u32) (size-start-4), GF_TRUE, GF_FALSE);
+					ccdec_queue_data(ctx, ts, (u8*) data + start+4, (u32) (size-start-4), GF_TRUE);
 					break;
 				default:
 					break;
@@ -377,7 +444,7 @@ GF_Err ccdec_process(GF_Filter *filter)
 				switch (o_type) {
 				case M2V_UDTA_START_CODE:
 					start = gf_m4v_get_object_start(m4v);
-					ccdec_queue_data(ctx, ts, (u8*) data + start+4, (u32) (size-start-4), GF_TRUE, GF_FALSE);
+					ccdec_queue_data(ctx, ts, (u8*) data + start+4, (u32) (size-start-4), GF_TRUE);
 					break;
 				}
 			}
@@ -416,7 +483,7 @@ GF_Err ccdec_process(GF_Filter *filter)
 				}
 				u32 terminal_provider_code = gf_bs_read_u16(ctx->bs);
 				if (terminal_provider_code==GF_ITU_T35_PROVIDER_ATSC) {
-					ccdec_queue_data(ctx, ts, (u8*) data + obu_start + obu_hdr_size, (u32) obu_size, GF_FALSE, GF_FALSE);
+					ccdec_queue_data(ctx, ts, (u8*) data + obu_start + obu_hdr_size, (u32) obu_size, GF_FALSE);
 				}
 				gf_bs_seek(ctx->bs, obu_start);
 			}
@@ -456,61 +523,9 @@ GF_Err ccdec_process(GF_Filter *filter)
 				if (nal_type==GF_VVC_NALU_SEI_PREFIX) sei_h_size = 2;
 				else if (nal_type==GF_VVC_NALU_SEI_SUFFIX) sei_h_size = 2;
 			}
-			//we have an sei message, parse it using EBP removal
+			//only SEI NALs are inspected, other NALs are skipped using their header
 			if (sei_h_size) {
-				if (!ctx->bs) ctx->bs = gf_bs_new(data, nal_size, GF_BITSTREAM_READ);
-				else gf_bs_reassign_buffer(ctx->bs, data, nal_size);
-				gf_bs_enable_emulation_byte_removal(ctx->bs, GF_TRUE);
-
-				//skip nal header
-				gf_bs_read_int(ctx->bs, sei_h_size*8);
-
-				while (gf_bs_available(ctx->bs) ) {
-					u32 i;
-					u32 sei_type = 0;
-					u32 sei_size = 0;
-					while (gf_bs_peek_bits(ctx->bs, 8, 0) == 0xFF) {
-						sei_type += 255;
-						gf_bs_read_int(ctx->bs, 8);
-					}
-					sei_type += gf_bs_read_int(ctx->bs, 8);
-					while (gf_bs_peek_bits(ctx->bs, 8, 0) == 0xFF) {
-						sei_size += 255;
-						gf_bs_read_int(ctx->bs, 8);
-					}
-					sei_size += gf_bs_read_int(ctx->bs, 8);
-
-					i=0;
-					if (sei_type == 4) {
-						//queuue
-						u32 pos = (u32) gf_bs_get_position(ctx->bs);
-						u32 country_code = gf_bs_read_u8(ctx->bs);
-						i++;
-						if (country_code == 0xFF) {
-							/*u32 country_code_extension = */gf_bs_read_u8(ctx->bs);
-							i++;
-						}
-						u32 terminal_provider_code = gf_bs_read_u16(ctx->bs);
-						i+=2;
-						if (terminal_provider_code==GF_ITU_T35_PROVIDER_ATSC) {
-							u8 *data = gf_malloc(sizeof(u8)*sei_size);
-							gf_bs_seek(ctx->bs, pos);
-							i=0;
-							while (i<sei_size) {
-								data[i] = gf_bs_read_u8(ctx->bs);
-								i++;
-							}
-							ccdec_queue_data(ctx, ts, (u8*) data, sei_size, GF_FALSE, GF_TRUE);
-						}
-					}
-					while (i < sei_size) {
-						gf_bs_read_u8(ctx->bs);
-						i++;
-					}
-					if (gf_bs_peek_bits(ctx->bs, 8, 0) == 0x80) {
-						break;
-					}
-				}
+				ccdec_parse_sei(ctx, ts, data, nal_size, sei_h_size);
 			}
 			data += nal_size;
 			size -= nal_size + ctx->nalu_size_len;
@@ -521,23 +536,15 @@ GF_Err ccdec_process(GF_Filter *filter)
 	return GF_OK;
 }
 
-static GF_Err ccdec_initialize(GF_Filter *filter)
-{
-	CCDecCtx *ctx = gf_filter_get_udta(filter);
-	ctx->cc_queue = gf_list_new();
-	if (!ctx->cc_queue) return GF_OUT_OF_MEM;
-	return GF_OK;
-}
-
 static void ccdec_finalize(GF_Filter *filter)
 {
+	u32 i;
 	CCDecCtx *ctx = gf_filter_get_udta(filter);
-	while (gf_list_count(ctx->cc_queue)) {
-		CCItem *cc = gf_list_pop_back(ctx->cc_queue);
-		gf_free(cc->data);
-		gf_free(cc);
+	for (i=0; i<ctx->cc_alloc; i++) {
+		if (ctx->cc_queue[i].data) gf_free(ctx->cc_queue[i].data);
 	}
-	gf_list_del(ctx->cc_queue);
+	if (ctx->cc_queue) gf_free(ctx->cc_queue);
+	if (ctx->sei_buf) gf_free(ctx->sei_buf);
 	if (ctx->bs) gf_bs_del(ctx->bs);
 	if (ctx->ccframe) gf_free(ctx->ccframe);
 }
@@ -581,7 +588,6 @@ GF_FilterRegister CCDecRegister = {
 	.private_size = sizeof(CCDecCtx),
 	.flags = GF_FS_REG_EXPLICIT_ONLY,
 	SETCAPS(CCDecCaps),
-	.initialize = ccdec_initialize,
 	.finalize = ccdec_finalize,
 	.process = ccdec_process,
 	.configure_pid = ccdec_configure_pid,
@@ -57,6 +57,7 @@ typedef struct
 
 	u32 channel_mask;
 	char ch_reorder[16];
+	Bool needs_reorder;
 	u64 last_cts, first_priming_cts_plus_one;
 	u32 ts_offset;
 } GF_FAADCtx;
@@ -216,6 +217,7 @@ base_object_type_error: /*error case*/
 #endif
 	ctx->num_samples = 1024;
 	ctx->signal_mc = ctx->num_channels>2 ? GF_TRUE : GF_FALSE;
+	ctx->needs_reorder = GF_FALSE;
 
 	gf_filter_pid_set_property(ctx->opid, GF_PROP_PID_SAMPLE_RATE, &PROP_UINT(ctx->sample_rate) );
 	gf_filter_pid_set_property(ctx->opid, GF_PROP_PID_SAMPLES_PER_FRAME, &PROP_UINT(ctx->num_samples) );
@@ -371,6 +373,13 @@ static GF_Err faaddec_process(GF_Filter *filter)
 			ctx->ch_reorder[idx] = ch;
 			//last one, no need to increment idx++;
 		}
+		/*no reordering needed if FAAD already outputs channels in our order*/
+		ctx->needs_reorder = GF_FALSE;
+		if (ctx->num_channels>2) {
+			for (i=0; (i<ctx->num_channels) && (i<16); i++) {
+				if (ctx->ch_reorder[i] != (char) i) ctx->needs_reorder = GF_TRUE;
+			}
+		}
 		faaddec_check_mc_config(ctx);
 	}
 
@@ -415,15 +424,18 @@ static GF_Err faaddec_process(GF_Filter *filter)
 		ctx->last_cts += ctx->info.samples;
 	}
 	/*we assume left/right order*/
-	if (ctx->num_channels<=2) {
+	if (!ctx->needs_reorder) {
 		memcpy(output, buffer, sizeof(short)* ctx->info.samples);
 	} else {
 		unsigned short *conv_in, *conv_out;
-		conv_in = (unsigned short *) buffer;
-		conv_out = (unsigned short *) output;
-		for (i=0; i<ctx->info.samples; i+=ctx->info.channels) {
-			for (j=0; j<ctx->info.channels; j++) {
-				conv_out[i + j] = conv_in[i + ctx->ch_reorder[j]];
+		u32 nb_ch = ctx->info.channels;
+		u32 nb_samples = (u32) ctx->info.samples / nb_ch;
+		/*one pass per channel with a fixed source offset, rather than a table lookup per sample*/
+		for (j=0; j<nb_ch; j++) {
+			conv_in = (unsigned short *) buffer + ctx->ch_reorder[j];
+			conv_out = (unsigned short *) output + j;
+			for (i=0; i<nb_samples; i++) {
+				conv_out[i*nb_ch] = conv_in[i*nb_ch];
 			}
 		}
 	}
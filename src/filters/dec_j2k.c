@@ -63,6 +63,13 @@
 
 #endif
 
+//threading API is available since OpenJPEG 2.2
+#if OPENJP2 && defined(OPJ_VERSION_MAJOR) && defined(OPJ_VERSION_MINOR)
+#if (OPJ_VERSION_MAJOR>2) || ((OPJ_VERSION_MAJOR==2) && (OPJ_VERSION_MINOR>=2))
+#define J2K_HAS_THREADS
+#endif
+#endif
+
 typedef struct
 {
 	GF_FilterPid *ipid, *opid;
@@ -70,6 +77,9 @@ typedef struct
 	/*no support for scalability with JPEG (progressive JPEG to test)*/
 	u32 bpp, nb_comp, width, height, out_size, pixel_format, dsi_size;
 	char *dsi;
+
+	//options
+	u32 nb_threads, reduce;
 } GF_J2KCtx;
 
 
@@ -223,6 +233,35 @@ static int int_ceildivpow2(int a, int b) {
 }
 
 #if OPENJP2
+/*write component samples to 8-bit output, shifting higher precisions and clamping
+dst_step is the distance between two samples in output, 1 for planar output*/
+static void j2kdec_write_comp(u8 *dst, u32 dst_pitch, u32 dst_step, opj_image_comp_t *comp, u32 w, u32 h)
+{
+	u32 i, j;
+	s32 shift = (comp->prec>8) ? comp->prec - 8 : 0;
+	s32 offset = comp->sgnd ? (1 << (comp->prec - 1)) : 0;
+	const s32 *src = comp->data;
+
+	for (j=0; j<h; j++) {
+		if (dst_step==1) {
+			//no stride in output, let the compiler vectorize this
+			for (i=0; i<w; i++) {
+				s32 v = (src[i] + offset) >> shift;
+				dst[i] = (u8) ((v<0) ? 0 : ((v>255) ? 255 : v));
+			}
+		} else {
+			u8 *out = dst;
+			for (i=0; i<w; i++) {
+				s32 v = (src[i] + offset) >> shift;
+				*out = (u8) ((v<0) ? 0 : ((v>255) ? 255 : v));
+				out += dst_step;
+			}
+		}
+		src += comp->w;
+		dst += dst_pitch;
+	}
+}
+
 typedef struct
 {
 	char *data;
@@ -277,7 +316,10 @@ static OPJ_BOOL j2kdec_stream_seek(OPJ_OFF_T nb_bytes, void *user_data)
 
 static GF_Err j2kdec_process(GF_Filter *filter)
 {
-	u32 i, w, wr, h, hr, wh, size, pf;
+	u32 i, w, h, size, pf;
+#if !OPENJP2
+	u32 wr, hr, wh;
+#endif
 	u8 *data, *buffer;
 	opj_dparameters_t parameters;	/* decompression parameters */
 #if OPENJP2
@@ -315,6 +357,8 @@ static GF_Err j2kdec_process(GF_Filter *filter)
 
 	/* set decoding parameters to default values */
 	opj_set_default_decoder_parameters(&parameters);
+	//discard highest resolution levels
+	parameters.cp_reduce = ctx->reduce;
 
 #if OPENJP2
 	codec = opj_create_decompress(OPJ_CODEC_J2K);
@@ -326,6 +370,15 @@ static GF_Err j2kdec_process(GF_Filter *filter)
 	if (res) res = opj_set_error_handler(codec, error_callback, NULL);
 
 	if (res) res = opj_setup_decoder(codec, &parameters);
+#ifdef J2K_HAS_THREADS
+	//tile and code-block decoding threads - an OpenJPEG codec only decodes a single codestream and owns its thread pool,
+	//so the pool is created and destroyed for each frame
+	if (res && (ctx->nb_threads>1) && opj_has_thread_support()) {
+		if (!opj_codec_set_threads(codec, ctx->nb_threads)) {
+			GF_LOG(GF_LOG_WARNING, GF_LOG_CODEC, ("[OpenJPEG] Failed to set number of threads to %d\n", ctx->nb_threads));
+		}
+	}
+#endif
 
 	stream = opj_stream_default_create(OPJ_STREAM_READ);
     opj_stream_set_read_function(stream, j2kdec_stream_read);
@@ -384,15 +437,16 @@ static GF_Err j2kdec_process(GF_Filter *filter)
 
 #if OPENJP2
 	ctx->nb_comp = image->numcomps;
-	w = image->x1;
-	h = image->y1;
+	//component sizes are already reduced
+	w = image->comps[0].w;
+	h = image->comps[0].h;
 #else
 	ctx->nb_comp = cinfo.numcomps;
-	w = cinfo.image_w;
-	h = cinfo.image_h;
+	w = int_ceildivpow2(cinfo.image_w, ctx->reduce);
+	h = int_ceildivpow2(cinfo.image_h, ctx->reduce);
 #endif
 	ctx->bpp = ctx->nb_comp * 8;
-	ctx->out_size = ctx->width * ctx->height * ctx->nb_comp /* * ctx->bpp / 8 */;
+	ctx->out_size = w * h * ctx->nb_comp /* * ctx->bpp / 8 */;
 
 	switch (ctx->nb_comp) {
 	case 1:
@@ -416,7 +470,11 @@ static GF_Err j2kdec_process(GF_Filter *filter)
 		&& (image->comps[0].h==2*image->comps[1].h)
 		&& (image->comps[1].h==image->comps[2].h)) {
 		pf = GF_PIXEL_YUV;
-		ctx->out_size = 3*ctx->width*ctx->height/2;
+#if OPENJP2
+		ctx->out_size = w * h + 2 * image->comps[1].w * image->comps[1].h;
+#else
+		ctx->out_size = 3*w*h/2;
+#endif
 		changed = GF_TRUE;
 	}
 	if (ctx->pixel_format!=pf) {
@@ -459,6 +517,26 @@ static GF_Err j2kdec_process(GF_Filter *filter)
 	pck_dst = gf_filter_pck_new_alloc(ctx->opid, ctx->out_size, &buffer);
 	if (!pck_dst) return GF_OUT_OF_MEM;
 
+#if OPENJP2
+	if (pf==GF_PIXEL_YUV) {
+		//write components in output planes
+		for (i=0; i<3; i++) {
+			opj_image_comp_t *comp = &image->comps[i];
+			j2kdec_write_comp(buffer, comp->w, 1, comp, comp->w, comp->h);
+			buffer += comp->w * comp->h;
+		}
+	} else {
+		//interleave components, all of the same size
+		for (i=0; i<ctx->nb_comp; i++) {
+			opj_image_comp_t *comp = &image->comps[i];
+			if ((comp->w != ctx->width) || (comp->h != ctx->height)) {
+				GF_LOG(GF_LOG_ERROR, GF_LOG_CODEC, ("[OpenJPEG] Subsampled component %d not supported for %d components\n", i, ctx->nb_comp));
+				break;
+			}
+			j2kdec_write_comp(buffer + i, ctx->width * ctx->nb_comp, ctx->nb_comp, comp, comp->w, comp->h);
+		}
+	}
+#else
 	w = image->comps[0].w;
 	wr = int_ceildivpow2(image->comps[0].w, image->comps[0].factor);
 	h = image->comps[0].h;
@@ -560,6 +638,7 @@ static GF_Err j2kdec_process(GF_Filter *filter)
 			}
 		}
 	}
+#endif
 
 	opj_image_destroy(image);
 	image = NULL;
@@ -577,6 +656,14 @@ static GF_Err j2kdec_process(GF_Filter *filter)
 
 static GF_Err j2kdec_initialize(GF_Filter *filter)
 {
+	GF_J2KCtx *ctx = gf_filter_get_udta(filter);
+	if (!ctx->nb_threads) {
+		GF_SystemRTInfo rti;
+		ctx->nb_threads = 1;
+		if (gf_sys_get_rti(0, &rti, 0) ) {
+			ctx->nb_threads = (rti.nb_cores>1) ? rti.nb_cores-1 : 1;
+		}
+	}
 #ifdef GPAC_ENABLE_COVERAGE
 	if (gf_sys_is_cov_mode()) {
 		error_callback(NULL, NULL);
@@ -599,6 +686,14 @@ static const GF_FilterCapability J2KCaps[] =
 	CAP_UINT(GF_CAPS_OUTPUT, GF_PROP_PID_CODECID, GF_CODECID_RAW),
 };
 
+#define OFFS(_n)	#_n, offsetof(GF_J2KCtx, _n)
+static const GF_FilterArgs J2KArgs[] =
+{
+	{ OFFS(nb_threads), "set number of decoding threads (if 0, uses number of cores minus one). The OpenJPEG thread pool is recreated for each frame, so threads only pay off on large pictures; use 1 for small ones", GF_PROP_UINT, "0", NULL, 0},
+	{ OFFS(reduce), "set number of highest resolution levels to discard, each level halving output width and height", GF_PROP_UINT, "0", NULL, GF_FS_ARG_HINT_ADVANCED},
+	{0}
+};
+
 GF_FilterRegister J2KRegister = {
 	.name = "j2kdec",
 #ifdef OPENJPEG_VERSION
@@ -612,6 +707,7 @@ GF_FilterRegister J2KRegister = {
 	GF_FS_SET_HELP("This filter decodes JPEG2000 streams through OpenJPEG2000 library.")
 	.private_size = sizeof(GF_J2KCtx),
 	.priority = 1,
+	.args = J2KArgs,
 	SETCAPS(J2KCaps),
 	.initialize = j2kdec_initialize,
 	.configure_pid = j2kdec_configure_pid,
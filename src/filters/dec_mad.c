@@ -174,19 +174,21 @@ static void maddec_finalize(GF_Filter *filter)
 	}
 }
 
-/*from miniMad.c*/
-#define MAD_SCALE(ret, s_chan)	\
-	chan = s_chan;				\
-	chan += (1L << (MAD_F_FRACBITS - 16));		\
-	if (chan >= MAD_F_ONE)					\
-		chan = MAD_F_ONE - 1;					\
-	else if (chan < -MAD_F_ONE)				\
-		chan = -MAD_F_ONE;				\
-	ret = chan >> (MAD_F_FRACBITS + 1 - 16);		\
- 
+/*from miniMad.c, clamping done without branches so that the loop can be vectorized*/
+static GFINLINE void maddec_to_s16(s16 *out, const mad_fixed_t *in, u32 nb_samples, u32 stride)
+{
+	u32 i;
+	for (i=0; i<nb_samples; i++) {
+		mad_fixed_t chan = in[i] + (1L << (MAD_F_FRACBITS - 16));
+		chan = (chan >= MAD_F_ONE) ? MAD_F_ONE - 1 : chan;
+		chan = (chan < -MAD_F_ONE) ? -MAD_F_ONE : chan;
+		out[i*stride] = (s16) (chan >> (MAD_F_FRACBITS + 1 - 16));
+	}
+}
+
 static GF_Err maddec_process(GF_Filter *filter)
 {
-	mad_fixed_t *left_ch, *right_ch, chan;
+	mad_fixed_t *left_ch, *right_ch;
 	u8 *ptr;
 	u8 *data;
 	u32 num, samples_to_trash, in_size; //, outSize=0;
@@ -321,25 +323,10 @@ mad_resync:
 	}
 
 
-	while (num-- > samples_to_trash) {
-		s32 rs;
-		MAD_SCALE(rs, (*left_ch++) );
+	maddec_to_s16((s16 *) ptr, left_ch, num - samples_to_trash, ctx->num_channels);
+	if (ctx->num_channels == 2)
+		maddec_to_s16((s16 *) ptr + 1, right_ch, num - samples_to_trash, 2);
 
-		*ptr = (rs >> 0) & 0xff;
-		ptr++;
-		*ptr = (rs >> 8) & 0xff;
-		ptr++;
-		//outSize += 2;
-
-		if (ctx->num_channels == 2) {
-			MAD_SCALE(rs, (*right_ch++) );
-			*ptr = (rs >> 0) & 0xff;
-			ptr++;
-			*ptr = (rs >> 8) & 0xff;
-			ptr++;
-			//outSize += 2;
-		}
-	}
 	gf_filter_pck_send(dst_pck);
 	return GF_OK;
 }
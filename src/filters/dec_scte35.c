@@ -51,6 +51,10 @@ typedef struct {
 	u64 clock;
 	u32 last_event_id;
 
+	// last parsed splice_info_section, repeated sections are not parsed again
+	u8 *last_section;
+	u32 last_section_size, last_section_alloc;
+
 	// used to compute event duration
 	u32 timescale;
 	u32 last_pck_dur;
@@ -100,6 +104,7 @@ static void scte35dec_finalize_internal(SCTE35DecCtx *ctx)
 		gf_free(evt);
 	}
 	gf_list_del(ctx->ordered_events);
+	if (ctx->last_section) gf_free(ctx->last_section);
 }
 
 static void scte35dec_finalize(GF_Filter *filter)
@@ -515,14 +520,41 @@ static void scte35dec_process_timing(SCTE35DecCtx *ctx, u64 dts, u32 timescale,
 	ctx->clock = MAX(ctx->clock, dts);
 }
 
+// splice_info_section are usually sent several times before the splice time: skip sections identical to the last one
+static Bool scte35dec_is_repeated_section(SCTE35DecCtx *ctx, const u8 *data, u32 size)
+{
+	if (ctx->last_section && (ctx->last_section_size == size) && !memcmp(ctx->last_section, data, size))
+		return GF_TRUE;
+
+	if (size > ctx->last_section_alloc) {
+		ctx->last_section = gf_realloc(ctx->last_section, size);
+		ctx->last_section_alloc = ctx->last_section ? size : 0;
+	}
+	if (ctx->last_section) {
+		memcpy(ctx->last_section, data, size);
+		ctx->last_section_size = size;
+	}
+	return GF_FALSE;
+}
+
 static GF_Err scte35dec_process_emsg(SCTE35DecCtx *ctx, const GF_PropertyValue *emsg, u64 dts)
 {
 	u64 pts = 0;
 	u32 dur = 0xFFFFFFFF;
 	Bool needs_idr = GF_FALSE;
+
+	if (scte35dec_is_repeated_section(ctx, emsg->value.data.ptr, emsg->value.data.size)) {
+		GF_LOG(GF_LOG_DEBUG, GF_LOG_CODEC, ("[Scte35Dec] repeated splice_info_section at dts="LLU", ignoring\n", dts));
+		return GF_OK;
+	}
+
 	// parsing is incomplete so we only check the first splice command ...
 	scte35dec_get_timing(emsg->value.data.ptr, emsg->value.data.size, &pts, &dur, &ctx->last_event_id, &needs_idr);
 
+	// pass-through mode only signals splice points
+	if (ctx->pass && !needs_idr)
+		return GF_OK;
+
 	GF_EventMessageBox *emib = (GF_EventMessageBox *) gf_isom_box_new(GF_ISOM_BOX_TYPE_EMIB);
 	if (!emib) return GF_OUT_OF_MEM;
 
@@ -533,22 +565,27 @@ static GF_Err scte35dec_process_emsg(SCTE35DecCtx *ctx, const GF_PropertyValue *
 	emib->event_duration = dur;
 	GF_LOG(GF_LOG_DEBUG, GF_LOG_CODEC, ("[Scte35Dec] detected pts="LLU" (delta="LLU") dur=%u at dts="LLU"\n", pts, pts-dts, dur, dts));
 	emib->event_id = ctx->last_event_id++;
-	emib->scheme_id_uri = gf_strdup("urn:scte:scte35:2013:bin");
-	emib->value = gf_strdup("1001");
-	emib->message_data_size = emsg->value.data.size;
-	emib->message_data = gf_malloc(emib->message_data_size);
-	if (!emib->message_data) return GF_OUT_OF_MEM;
-	memcpy(emib->message_data, emsg->value.data.ptr, emib->message_data_size);
-
-	GF_Err e = gf_isom_box_size((GF_Box*)emib);
-	if (e) {
-		gf_isom_box_del((GF_Box*)emib);
-		return e;
-	}
 
-	if (!ctx->pass || (ctx->pass && needs_idr))
-		scte35dec_schedule(ctx, dts, emib);
+	// in pass-through mode the box is never written, only its timing is used
+	if (!ctx->pass) {
+		emib->scheme_id_uri = gf_strdup("urn:scte:scte35:2013:bin");
+		emib->value = gf_strdup("1001");
+		emib->message_data_size = emsg->value.data.size;
+		emib->message_data = gf_malloc(emib->message_data_size);
+		if (!emib->message_data) {
+			gf_isom_box_del((GF_Box*)emib);
+			return GF_OUT_OF_MEM;
+		}
+		memcpy(emib->message_data, emsg->value.data.ptr, emib->message_data_size);
+
+		GF_Err e = gf_isom_box_size((GF_Box*)emib);
+		if (e) {
+			gf_isom_box_del((GF_Box*)emib);
+			return e;
+		}
+	}
 
+	scte35dec_schedule(ctx, dts, emib);
 	return GF_OK;
 }
 
@@ -557,7 +594,11 @@ static Bool scte35dec_is_splice_point(SCTE35DecCtx *ctx, u64 cts)
 	Event *evt = gf_list_get(ctx->ordered_events, 0);
 	if (!evt) return GF_FALSE;
 	Bool is_splice = (evt->dts + evt->emib->presentation_time_delta == cts);
-	if (is_splice) gf_list_pop_front(ctx->ordered_events);
+	if (is_splice) {
+		gf_list_pop_front(ctx->ordered_events);
+		gf_isom_box_del((GF_Box*)evt->emib);
+		gf_free(evt);
+	}
 	return is_splice;
 }
 
@@ -591,9 +632,11 @@ static GF_Err scte35dec_process_dispatch(SCTE35DecCtx *ctx, u64 dts)
 
 static GF_Err scte35dec_process_passthrough(SCTE35DecCtx *ctx, GF_FilterPacket *pck)
 {
-	GF_FilterPacket *dst_pck = gf_filter_pck_new_clone(ctx->opid, pck, NULL);
+	// forward by reference, the media data is never copied
+	GF_FilterPacket *dst_pck = gf_filter_pck_new_ref(ctx->opid, 0, 0, pck);
 	if (!dst_pck)
 		return GF_OUT_OF_MEM;
+	gf_filter_pck_merge_properties(pck, dst_pck);
 
 	u64 cts = gf_filter_pck_get_cts(pck);
 	if (scte35dec_is_splice_point(ctx, cts)) {
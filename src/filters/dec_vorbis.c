@@ -170,34 +170,32 @@ static GF_Err vorbisdec_configure_pid(GF_Filter *filter, GF_FilterPid *pid, Bool
 static GFINLINE void vorbis_to_intern(u32 samples, Float **pcm, char *buf, u32 channels)
 {
 	u32 i, j;
-	s32 val;
 	ogg_int16_t *data = (ogg_int16_t*)buf ;
 
 	for (i=0 ; i<channels ; i++) {
 		Float *mono;
 		ogg_int16_t *ptr;
-		ptr = &data[i];
-		if (!ptr) break;
-		
+		u32 idx = i;
+
 		if (channels>2) {
 			/*center is third in gpac*/
-			if (i==1) ptr = &data[2];
+			if (i==1) idx = 2;
 			/*right is 2nd in gpac*/
-			else if (i==2) ptr = &data[1];
+			else if (i==2) idx = 1;
 			/*LFE is 4th in gpac*/
 			if ((channels==6) && (i>3)) {
-				if (i==6) ptr = &data[4];	/*LFE*/
-				else ptr = &data[i+1];	/*back l/r*/
+				if (i==6) idx = 4;	/*LFE*/
+				else idx = i+1;	/*back l/r*/
 			}
 		}
-
+		ptr = &data[idx];
 		mono = pcm[i];
+		/*clamp in float domain, no branches in the loop so that it can be vectorized*/
 		for (j=0; j<samples; j++) {
-			val = (s32) (mono[j] * 32767.f);
-			if (val > 32767) val = 32767;
-			if (val < -32768) val = -32768;
-			(*ptr) = val;
-			ptr += channels;
+			Float val = mono[j] * 32767.f;
+			val = (val > 32767.f) ? 32767.f : val;
+			val = (val < -32768.f) ? -32768.f : val;
+			ptr[j*channels] = (ogg_int16_t) (s32) val;
 		}
 	}
 }
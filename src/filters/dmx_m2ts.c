@@ -1190,13 +1190,19 @@ static void m2tsdmx_on_event(GF_M2TS_Demuxer *ts, u32 evt_type, void *param)
 			GF_SAFEALLOC(t, GF_M2TS_Prop);
 			if (!t) break;
 			t->type = M2TS_ID3;
-			bs = gf_bs_new(NULL, 0, GF_BITSTREAM_WRITE);
+			//header and payload written in a single allocation, payload is not parsed
+			t->len = 16 + pck->data_len;
+			t->data = gf_malloc(t->len);
+			if (!t->data) {
+				gf_free(t);
+				break;
+			}
+			bs = gf_bs_new(t->data, 16, GF_BITSTREAM_WRITE);
 			gf_bs_write_u32(bs, 90000);                     // timescale
 			gf_bs_write_u64(bs, pck->PTS);                  // pts
 			gf_bs_write_u32(bs, pck->data_len);				// data length (bytes)
-			gf_bs_write_data(bs, pck->data, pck->data_len); // data
-			gf_bs_get_content(bs, &t->data, &t->len);
 			gf_bs_del(bs);
+			memcpy(t->data + 16, pck->data, pck->data_len); // data
 
 			if (!es->props) {
 				es->props = gf_list_new();
@@ -1208,7 +1214,6 @@ static void m2tsdmx_on_event(GF_M2TS_Demuxer *ts, u32 evt_type, void *param)
 	case GF_M2TS_EVT_SCTE35_SPLICE_INFO:
 	{
 		GF_M2TS_SL_PCK *pck = (GF_M2TS_SL_PCK*)param;
-		GF_BitStream *bs;
 		GF_M2TS_Prop *t;
 
 		//for now all SCTE35 must be associated with a stream
@@ -1233,11 +1238,14 @@ static void m2tsdmx_on_event(GF_M2TS_Demuxer *ts, u32 evt_type, void *param)
 			GF_SAFEALLOC(t, GF_M2TS_Prop);
 			if (!t) break;
 			t->type = M2TS_SCTE35;
-			bs = gf_bs_new(NULL, 0, GF_BITSTREAM_WRITE);
 			// ANSI/SCTE 67 2017 (13.1.1.3): "the entire SCTE 35 splice_info_section starting at the table_id and ending with the CRC_32"
-			gf_bs_write_data(bs, pck->data, pck->data_len);
-			gf_bs_get_content(bs, &t->data, &t->len);
-			gf_bs_del(bs);
+			t->data = gf_malloc(pck->data_len);
+			if (!t->data) {
+				gf_free(t);
+				break;
+			}
+			memcpy(t->data, pck->data, pck->data_len);
+			t->len = pck->data_len;
 
 			if (!es->props) {
 				es->props = gf_list_new();
@@ -1664,6 +1664,35 @@ static u32 cenc_get_clear_bytes(GF_CENCStream *cstr, GF_BitStream *plaintext_bs,
 }
 #endif
 
+//get NAL header info set by the reframer, if matching the NAL units of the sample
+static const GF_PropertyValue *cenc_get_nal_hdrs(GF_CENCStream *cstr, GF_FilterPacket *pck, const u8 *data, u32 size)
+{
+	u32 pos=0, idx=0;
+	const GF_PropertyValue *p;
+	if (!cstr->slice_header_clear || cstr->is_saes) return NULL;
+	if ((cstr->cenc_codec!=CENC_AVC) && (cstr->cenc_codec!=CENC_HEVC)) return NULL;
+	p = gf_filter_pck_get_property(pck, GF_PROP_PCK_NALU_HDRS);
+	if (!p || (p->type!=GF_PROP_UINT_LIST)) return NULL;
+
+	while (pos + cstr->nalu_size_length <= size) {
+		u32 k, nal_size=0;
+		for (k=0; k<cstr->nalu_size_length; k++)
+			nal_size = (nal_size<<8) | data[pos+k];
+		pos += cstr->nalu_size_length;
+		if (!nal_size) continue;
+		if ((2*idx+1 >= p->value.uint_list.nb_items)
+			|| (p->value.uint_list.vals[2*idx] != nal_size)
+			|| (p->value.uint_list.vals[2*idx+1] > nal_size)
+		)
+			return NULL;
+		idx++;
+		pos += nal_size;
+	}
+	if ((pos != size) || (2*idx != p->value.uint_list.nb_items))
+		return NULL;
+	return p;
+}
+
 static GF_Err cenc_encrypt_packet(GF_CENCEncCtx *ctx, GF_CENCStream *cstr, GF_FilterPacket *pck)
 {
 	GF_BitStream *sai_bs;
@@ -1681,6 +1710,8 @@ static GF_Err cenc_encrypt_packet(GF_CENCEncCtx *ctx, GF_CENCStream *cstr, GF_Fi
 	u32 nb_subs_crypted = 0;
 	u32 nb_sub_offset;
 	Bool multi_key;
+	const GF_PropertyValue *nal_hdrs;
+	u32 nal_idx = 0;
 
 	if (cstr->multi_key) {
 		nb_keys = cstr->tci->nb_keys;
@@ -1705,6 +1736,8 @@ static GF_Err cenc_encrypt_packet(GF_CENCEncCtx *ctx, GF_CENCStream *cstr, GF_Fi
 	}
 
 	data = gf_filter_pck_get_data(pck, &pck_size);
+	//slice header sizes already computed by the reframer, no need to parse them
+	nal_hdrs = cenc_get_nal_hdrs(cstr, pck, data, pck_size);
 
 	//CENC can use inplace processing for decryption, SAES cannot
 	if (!cstr->is_saes) {
@@ -1770,7 +1803,12 @@ static GF_Err cenc_encrypt_packet(GF_CENCEncCtx *ctx, GF_CENCStream *cstr, GF_Fi
 				if (nalu_size == 0) {
 					continue;
 				}
-				clear_bytes = cenc_get_clear_bytes(cstr, ctx->bs_r, (char *) data, nalu_size, cstr->bytes_in_nal_hdr);
+				if (nal_hdrs) {
+					clear_bytes = nal_hdrs->value.uint_list.vals[2*nal_idx+1];
+					nal_idx++;
+				} else {
+					clear_bytes = cenc_get_clear_bytes(cstr, ctx->bs_r, (char *) data, nalu_size, cstr->bytes_in_nal_hdr);
+				}
 				break;
 
 			case CENC_AV1:
@@ -2284,4 +2284,24 @@ void ffmpeg_check_threads(GF_Filter *filter, AVDictionary *options, AVCodecConte
 	codecctx->thread_type = 0;
 #endif
 }
+
+GF_Err ffmpeg_frame_get_plane(GF_FilterFrameInterface *frame_ifce, u32 plane_idx, const u8 **outPlane, u32 *outStride)
+{
+	AVFrame *frame = frame_ifce ? (AVFrame *) frame_ifce->user_data : NULL;
+	if (!outPlane || !outStride) return GF_BAD_PARAM;
+	*outPlane = NULL;
+	*outStride = 0;
+	if (!frame || (plane_idx>=AV_NUM_DATA_POINTERS) || !frame->data[plane_idx]) return GF_BAD_PARAM;
+	//bottom-up frames not supported
+	if (frame->linesize[plane_idx]<0) return GF_NOT_SUPPORTED;
+	*outPlane = frame->data[plane_idx];
+	*outStride = frame->linesize[plane_idx];
+	return GF_OK;
+}
+
+AVFrame *ffmpeg_frame_from_ifce(GF_FilterFrameInterface *frame_ifce)
+{
+	if (!frame_ifce || (frame_ifce->get_plane != ffmpeg_frame_get_plane)) return NULL;
+	return (AVFrame *) frame_ifce->user_data;
+}
 #endif
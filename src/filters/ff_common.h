@@ -138,3 +138,8 @@ GF_Err ffmpeg_codec_par_to_gpac(AVCodecParameters *codecpar, GF_FilterPid *opid,
 GF_Err ffmpeg_update_arg(const char *log_name, void *ctx, AVDictionary **options, const char *arg_name, const GF_PropertyValue *arg_val);
 
 void ffmpeg_check_threads(GF_Filter *filter, AVDictionary *options, AVCodecContext *codecctx);
+
+/*frame interface wrapping a decoded AVFrame, user_data is the AVFrame*/
+GF_Err ffmpeg_frame_get_plane(GF_FilterFrameInterface *frame_ifce, u32 plane_idx, const u8 **outPlane, u32 *outStride);
+/*gets AVFrame associated with frame interface, NULL if not an ffmpeg frame*/
+AVFrame *ffmpeg_frame_from_ifce(GF_FilterFrameInterface *frame_ifce);
@@ -54,10 +54,18 @@ static GF_Err ffdec_configure_pid(GF_Filter *filter, GF_FilterPid *pid, Bool is_
 
 #include <gpac/color.h>
 
+//decoded frame dispatched without copy, holding a reference to the AVFrame buffers
+typedef struct
+{
+	GF_FilterFrameInterface frame_ifce;
+	AVFrame *frame;
+} FFDecFrame;
+
 typedef struct _gf_ffdec_ctx
 {
 	GF_PropStringList ffcmap;
 	char *c;
+	Bool no_copy;
 
 	Bool owns_context;
 	AVCodecContext *decoder;
@@ -113,12 +121,18 @@ typedef struct _gf_ffdec_ctx
 	Bool prev_sub_valid, warned_txt;
 	GF_IRect irc;
 	GF_FilterFrameInterface sub_ifce;
+
+	//audio frames dispatched without copy, released from consumer threads
+	GF_List *frames_out;
+	GF_Mutex *frames_mx;
 } GF_FFDecodeCtx;
 
 static GF_Err ffdec_initialize(GF_Filter *filter)
 {
 	GF_FFDecodeCtx *ctx = (GF_FFDecodeCtx *) gf_filter_get_udta(filter);
 	ctx->src_packets = gf_list_new();
+	ctx->frames_out = gf_list_new();
+	ctx->frames_mx = gf_mx_new("FFDecFrames");
 	ctx->sar.den = 1;
 
 #if (LIBAVCODEC_VERSION_MAJOR >= 59)
@@ -142,6 +156,8 @@ static GF_Err ffdec_initialize(GF_Filter *filter)
 	return GF_OK;
 }
 
+static void ffdec_frame_del(FFDecFrame *f);
+
 static void ffdec_finalize(GF_Filter *filter)
 {
 	GF_FFDecodeCtx *ctx = (GF_FFDecodeCtx *) gf_filter_get_udta(filter);
@@ -155,6 +171,17 @@ static void ffdec_finalize(GF_Filter *filter)
 		gf_filter_pck_unref(pck);
 	}
 	gf_list_del(ctx->src_packets);
+	//release frames of packets not yet destroyed
+	gf_mx_p(ctx->frames_mx);
+	while (gf_list_count(ctx->frames_out)) {
+		FFDecFrame *f = gf_list_pop_back(ctx->frames_out);
+		ffdec_frame_del(f);
+	}
+	gf_list_del(ctx->frames_out);
+	ctx->frames_out = NULL;
+	gf_mx_v(ctx->frames_mx);
+	gf_mx_del(ctx->frames_mx);
+	ctx->frames_mx = NULL;
 
 #if (LIBAVCODEC_VERSION_MAJOR >= 59)
 	av_packet_free(&ctx->pkt);
@@ -166,6 +193,57 @@ static void ffdec_finalize(GF_Filter *filter)
 	return;
 }
 
+static FFDecFrame *ffdec_frame_new(AVFrame *src)
+{
+	FFDecFrame *f;
+	GF_SAFEALLOC(f, FFDecFrame);
+	if (!f) return NULL;
+	f->frame = av_frame_alloc();
+	if (!f->frame || (av_frame_ref(f->frame, src)<0)) {
+		if (f->frame) av_frame_free(&f->frame);
+		gf_free(f);
+		return NULL;
+	}
+	f->frame_ifce.user_data = f->frame;
+	f->frame_ifce.get_plane = ffmpeg_frame_get_plane;
+	return f;
+}
+
+static void ffdec_frame_del(FFDecFrame *f)
+{
+	av_frame_free(&f->frame);
+	gf_free(f);
+}
+
+static void ffdec_video_frame_release(GF_Filter *filter, GF_FilterPid *pid, GF_FilterPacket *pck)
+{
+	FFDecFrame *f = (FFDecFrame *) gf_filter_pck_get_frame_interface(pck);
+	if (f) ffdec_frame_del(f);
+}
+
+static void ffdec_audio_frame_release(GF_Filter *filter, GF_FilterPid *pid, GF_FilterPacket *pck)
+{
+	u32 i, count, size;
+	FFDecFrame *f = NULL;
+	GF_FFDecodeCtx *ctx = (GF_FFDecodeCtx *) gf_filter_get_udta(filter);
+	const u8 *data = gf_filter_pck_get_data(pck, &size);
+
+	//frames already released at finalize
+	if (!ctx->frames_out) return;
+	gf_mx_p(ctx->frames_mx);
+	count = gf_list_count(ctx->frames_out);
+	for (i=0; i<count; i++) {
+		f = gf_list_get(ctx->frames_out, i);
+		if (f->frame->extended_data[0] == data) {
+			gf_list_rem(ctx->frames_out, i);
+			break;
+		}
+		f = NULL;
+	}
+	gf_mx_v(ctx->frames_mx);
+	if (f) ffdec_frame_del(f);
+}
+
 static void ffdec_check_pix_fmt_change(struct _gf_ffdec_ctx *ctx, u32 pix_fmt)
 {
 	if (ctx->pixel_fmt != pix_fmt) {
@@ -217,6 +295,7 @@ static GF_Err ffdec_process_video(GF_Filter *filter, struct _gf_ffdec_ctx *ctx)
 	u32 i, count, ff_pfmt;
 	u32 size=0, outsize, stride, stride_uv, uv_height, nb_planes;
 	u8 *out_buffer;
+	FFDecFrame *dst_frame;
 	GF_FilterPacket *pck_src;
 	GF_FilterPacket *dst_pck;
 	GF_FilterPacket *pck = gf_filter_pid_get_packet(ctx->in_pid);
@@ -439,8 +518,33 @@ restart:
 		return GF_OK;
 	}
 
-	dst_pck = gf_filter_pck_new_alloc(ctx->out_pid, outsize, &out_buffer);
-	if (!dst_pck) return GF_OUT_OF_MEM;
+	ff_pfmt = ctx->decoder->pix_fmt;
+	if (ff_pfmt==AV_PIX_FMT_YUVJ420P) {
+		ff_pfmt = AV_PIX_FMT_YUV420P;
+		if (!ctx->force_full_range) {
+			ctx->force_full_range = GF_TRUE;
+			gf_filter_pid_set_property(ctx->out_pid, GF_PROP_PID_COLR_RANGE, &PROP_BOOL(GF_TRUE));
+		}
+	}
+
+	dst_frame = NULL;
+	//decoder output matches our pixel format, dispatch the decoded frame without copy
+	if (ctx->no_copy && (ffmpeg_pixfmt_to_gpac(ff_pfmt, GF_TRUE) == ctx->pixel_fmt)
+		&& (frame->width == ctx->width) && (frame->height == ctx->height)
+		&& (frame->linesize[0]>0)
+	) {
+		dst_frame = ffdec_frame_new(frame);
+	}
+	if (dst_frame) {
+		dst_pck = gf_filter_pck_new_frame_interface(ctx->out_pid, &dst_frame->frame_ifce, ffdec_video_frame_release);
+		if (!dst_pck) {
+			ffdec_frame_del(dst_frame);
+			return GF_OUT_OF_MEM;
+		}
+	} else {
+		dst_pck = gf_filter_pck_new_alloc(ctx->out_pid, outsize, &out_buffer);
+		if (!dst_pck) return GF_OUT_OF_MEM;
+	}
 
 	if (pck_src) {
 		gf_filter_pck_merge_properties(pck_src, dst_pck);
@@ -455,14 +559,7 @@ restart:
     gf_filter_pck_set_dts(dst_pck, out_cts);
     gf_filter_pck_set_cts(dst_pck, out_cts);
 
-	ff_pfmt = ctx->decoder->pix_fmt;
-	if (ff_pfmt==AV_PIX_FMT_YUVJ420P) {
-		ff_pfmt = AV_PIX_FMT_YUV420P;
-		if (!ctx->force_full_range) {
-			ctx->force_full_range = GF_TRUE;
-			gf_filter_pid_set_property(ctx->out_pid, GF_PROP_PID_COLR_RANGE, &PROP_BOOL(GF_TRUE));
-		}
-	}
+	if (dst_frame) goto send_frame;
 
 	memset(&dst_planes, 0, sizeof(u8 *)*5);
 	memset(&dst_stride, 0, sizeof(u32)*5);
@@ -532,7 +629,7 @@ restart:
 		sws_scale(ctx->sws_ctx, (const uint8_t * const*)frame->data, frame->linesize, 0, ctx->height, dst_planes, dst_stride);
 	}
 
-
+send_frame:
 	gf_filter_pck_set_seek_flag(dst_pck, GF_FALSE);
 
 	if (frame->interlaced_frame)
@@ -559,6 +656,7 @@ static GF_Err ffdec_process_audio(GF_Filter *filter, struct _gf_ffdec_ctx *ctx)
 	Bool is_eos=GF_FALSE;
 	u8 *data;
 	AVFrame *frame;
+	FFDecFrame *dst_frame;
 	GF_FilterPacket *dst_pck, *src_pck;
 	GF_FilterPacket *pck;
 
@@ -743,24 +841,53 @@ dispatch_next:
 	}
 
 	output_size = (frame->nb_samples - samples_to_trash) * ctx->channels * ctx->bytes_per_sample;
-	dst_pck = gf_filter_pck_new_alloc(ctx->out_pid, output_size, &data);
-	if (!dst_pck) return GF_OUT_OF_MEM;
-
-	switch (frame->format) {
-	case AV_SAMPLE_FMT_U8P:
-	case AV_SAMPLE_FMT_S16P:
-	case AV_SAMPLE_FMT_S32P:
-	case AV_SAMPLE_FMT_FLTP:
-	case AV_SAMPLE_FMT_DBLP:
-		for (i=0; (u32) i< ctx->channels; i++) {
-			char *inputChannel = frame->extended_data[i] + samples_to_trash * ctx->bytes_per_sample;
-			memcpy(data, inputChannel, ctx->bytes_per_sample * (frame->nb_samples-samples_to_trash) );
-			data += ctx->bytes_per_sample * (frame->nb_samples-samples_to_trash);
+
+	dst_frame = NULL;
+	//samples are contiguous in the decoded frame (packed, mono or contiguous planes), dispatch without copy
+	if (ctx->no_copy && output_size && !samples_to_trash) {
+		u32 plane_size = frame->nb_samples * ctx->bytes_per_sample;
+		Bool contiguous = GF_TRUE;
+		if (av_sample_fmt_is_planar(frame->format)) {
+			for (i=1; (u32) i< ctx->channels; i++) {
+				if (frame->extended_data[i] != frame->extended_data[0] + i*plane_size) {
+					contiguous = GF_FALSE;
+					break;
+				}
+			}
+		}
+		if (contiguous) dst_frame = ffdec_frame_new(frame);
+	}
+	if (dst_frame) {
+		dst_pck = gf_filter_pck_new_shared(ctx->out_pid, dst_frame->frame->extended_data[0], output_size, ffdec_audio_frame_release);
+		if (!dst_pck) {
+			ffdec_frame_del(dst_frame);
+			return GF_OUT_OF_MEM;
+		}
+		gf_mx_p(ctx->frames_mx);
+		gf_list_add(ctx->frames_out, dst_frame);
+		gf_mx_v(ctx->frames_mx);
+	} else {
+		dst_pck = gf_filter_pck_new_alloc(ctx->out_pid, output_size, &data);
+		if (!dst_pck) return GF_OUT_OF_MEM;
+	}
+
+	if (!dst_frame) {
+		switch (frame->format) {
+		case AV_SAMPLE_FMT_U8P:
+		case AV_SAMPLE_FMT_S16P:
+		case AV_SAMPLE_FMT_S32P:
+		case AV_SAMPLE_FMT_FLTP:
+		case AV_SAMPLE_FMT_DBLP:
+			for (i=0; (u32) i< ctx->channels; i++) {
+				char *inputChannel = frame->extended_data[i] + samples_to_trash * ctx->bytes_per_sample;
+				memcpy(data, inputChannel, ctx->bytes_per_sample * (frame->nb_samples-samples_to_trash) );
+				data += ctx->bytes_per_sample * (frame->nb_samples-samples_to_trash);
+			}
+			break;
+		default:
+			memcpy(data, ctx->frame->data[0] + samples_to_trash * ctx->bytes_per_sample, ctx->bytes_per_sample * (frame->nb_samples - samples_to_trash) * ctx->channels);
+			break;
 		}
-		break;
-	default:
-		memcpy(data, ctx->frame->data[0] + samples_to_trash * ctx->bytes_per_sample, ctx->bytes_per_sample * (frame->nb_samples - samples_to_trash) * ctx->channels);
-		break;
 	}
 
 	//we don't follow the same approach as in video, we assume the codec works with one in one out
@@ -1541,6 +1668,7 @@ static const GF_FilterArgs FFDecodeArgs[] =
 {
 	{ OFFS(ffcmap), "codec map", GF_PROP_STRING_LIST, NULL, NULL, 0},
 	{ OFFS(c), "codec name (GPAC or ffmpeg), only used to query possible arguments - updated to ffmpeg codec name after initialization", GF_PROP_STRING, NULL, NULL, GF_FS_ARG_HINT_EXPERT},
+	{ OFFS(no_copy), "dispatch decoded frames without copy when no pixel format conversion is needed - decoded frames are then held by downstream filters, which may stall decoders with a small frame pool", GF_PROP_BOOL, "false", NULL, GF_FS_ARG_HINT_ADVANCED},
 	{ "*", -1, "any possible options defined for AVCodecContext and sub-classes. See `gpac -hx ffdec` and `gpac -hx ffdec:*`", GF_PROP_STRING, NULL, NULL, GF_FS_ARG_META},
 	{0}
 };
@@ -417,6 +417,15 @@ static void ffenc_log_video(GF_Filter *filter, struct _gf_ffenc_ctx *ctx, AVPack
 	}
 }
 
+//release buffers referenced from source frame, the encoder holds its own references
+static void ffenc_release_frame_buffers(struct _gf_ffenc_ctx *ctx)
+{
+	u32 i;
+	for (i=0; i<AV_NUM_DATA_POINTERS; i++) {
+		if (ctx->frame->buf[i]) av_buffer_unref(&ctx->frame->buf[i]);
+	}
+}
+
 static GF_Err ffenc_process_video(GF_Filter *filter, struct _gf_ffenc_ctx *ctx)
 {
 	AVPacket *pkt;
@@ -582,12 +591,21 @@ static GF_Err ffenc_process_video(GF_Filter *filter, struct _gf_ffenc_ctx *ctx)
 		} else {
 			GF_Err e=GF_NOT_SUPPORTED;
 			GF_FilterFrameInterface *frame_ifce = gf_filter_pck_get_frame_interface(pck);
-			if (frame_ifce && frame_ifce->get_plane) {
+			AVFrame *src_frame = ffmpeg_frame_from_ifce(frame_ifce);
+			if (src_frame) {
+				//frame from ffmpeg decoder, reference its buffers so that the encoder does not copy them
+				for (i=0; i<AV_NUM_DATA_POINTERS; i++) {
+					ctx->frame->data[i] = src_frame->data[i];
+					ctx->frame->linesize[i] = src_frame->linesize[i];
+					if (src_frame->buf[i]) ctx->frame->buf[i] = av_buffer_ref(src_frame->buf[i]);
+				}
+				e = GF_OK;
+			} else if (frame_ifce && frame_ifce->get_plane) {
 				e = frame_ifce->get_plane(frame_ifce, 0, (const u8 **) &ctx->frame->data[0], &ctx->frame->linesize[0]);
 				if (!e && (ctx->nb_planes>1)) {
 					e = frame_ifce->get_plane(frame_ifce, 1, (const u8 **) &ctx->frame->data[1], &ctx->frame->linesize[1]);
 					if (!e && (ctx->nb_planes>2)) {
-						e = frame_ifce->get_plane(frame_ifce, 1, (const u8 **) &ctx->frame->data[2], &ctx->frame->linesize[2]);
+						e = frame_ifce->get_plane(frame_ifce, 2, (const u8 **) &ctx->frame->data[2], &ctx->frame->linesize[2]);
 					}
 				}
 			}
@@ -632,6 +650,7 @@ static GF_Err ffenc_process_video(GF_Filter *filter, struct _gf_ffenc_ctx *ctx)
 #if (LIBAVFORMAT_VERSION_MAJOR<59)
 		ctx->frame->pkt_dts = ctx->frame->pkt_pts = ctx->frame->pts;
 		res = avcodec_encode_video2(ctx->encoder, pkt, ctx->frame, &gotpck);
+		ffenc_release_frame_buffers(ctx);
 		ctx->nb_frames_in++;
 		if (temp_data) {
 			gf_free(temp_data);
@@ -641,6 +660,7 @@ static GF_Err ffenc_process_video(GF_Filter *filter, struct _gf_ffenc_ctx *ctx)
 		ctx->frame->pkt_dts = ctx->frame->pts;
 		GF_LOG(GF_LOG_DEBUG, GF_LOG_CODEC, ("[FFEnc] Encoding video frame PTS "LLU"\n", ctx->frame->pts));
 		res = avcodec_send_frame(ctx->encoder, ctx->frame);
+		ffenc_release_frame_buffers(ctx);
 		if (temp_data) {
 			gf_free(temp_data);
 			//flush by sending NULL frame
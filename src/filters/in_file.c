@@ -26,12 +26,14 @@
 
 #include <gpac/filters.h>
 #include <gpac/constants.h>
+#include <gpac/thread.h>
 
 #ifndef GPAC_DISABLE_FIN
 
 #ifdef GPAC_HAS_FD
 #include <unistd.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <fcntl.h>
 #endif
 
@@ -44,6 +46,16 @@ enum{
 	FILE_RAND_SC_AV1
 };
 
+#ifdef GPAC_HAS_FD
+//file mapping, kept until all packets referencing it are released
+typedef struct
+{
+	u8 *data;
+	u64 size;
+	u32 nb_pck;
+} FileInMap;
+#endif
+
 typedef struct
 {
 	//options
@@ -53,6 +65,8 @@ typedef struct
 	GF_PropData pck;
 	GF_Fraction64 range;
 	GF_Fraction ptime;
+	Bool mmap;
+	u32 readahead;
 
 	//only one output pid declared
 	GF_FilterPid *pid;
@@ -60,6 +74,16 @@ typedef struct
 	FILE *file;
 #ifdef GPAC_HAS_FD
 	int fd;
+	u8 *map;
+	u64 map_size;
+	//number of packets in flight referencing the current mapping
+	u32 map_nb_pck;
+	//block size hinted by consumer for mapped dispatch, block buffer is not used in this mode
+	u32 map_block_size;
+	//previous mappings with packets still in flight
+	GF_List *old_maps;
+	//packets may be released from other threads
+	GF_Mutex *map_mx;
 #endif
 	u64 file_size;
 	u64 file_pos, end_pos;
@@ -73,6 +97,107 @@ typedef struct
 	Bool no_failure;
 } GF_FileInCtx;
 
+#ifdef GPAC_HAS_FD
+static void filein_unmap(GF_FileInCtx *ctx)
+{
+	if (!ctx->map) return;
+	gf_mx_p(ctx->map_mx);
+	//packets still reference the mapping, release it when the last one is destroyed
+	if (ctx->map_nb_pck) {
+		FileInMap *omap;
+		GF_SAFEALLOC(omap, FileInMap);
+		if (omap) {
+			omap->data = ctx->map;
+			omap->size = ctx->map_size;
+			omap->nb_pck = ctx->map_nb_pck;
+			if (!ctx->old_maps) ctx->old_maps = gf_list_new();
+			gf_list_add(ctx->old_maps, omap);
+		} else {
+			GF_LOG(GF_LOG_ERROR, GF_LOG_MMIO, ("[FileIn] Failed to allocate mapping descriptor, leaking mapping\n"));
+		}
+	} else {
+		munmap(ctx->map, (size_t) ctx->map_size);
+	}
+	ctx->map = NULL;
+	ctx->map_size = 0;
+	ctx->map_nb_pck = 0;
+	ctx->map_block_size = 0;
+	gf_mx_v(ctx->map_mx);
+}
+
+static void filein_map_pck_destructor(GF_Filter *filter, GF_FilterPid *pid, GF_FilterPacket *pck)
+{
+	u32 i, size;
+	GF_FileInCtx *ctx = (GF_FileInCtx *) gf_filter_get_udta(filter);
+	const u8 *data = gf_filter_pck_get_data(pck, &size);
+
+	gf_mx_p(ctx->map_mx);
+	if (ctx->map && (data >= ctx->map) && (data < ctx->map + ctx->map_size)) {
+		if (ctx->map_nb_pck) ctx->map_nb_pck--;
+		gf_mx_v(ctx->map_mx);
+		return;
+	}
+	for (i=0; i<gf_list_count(ctx->old_maps); i++) {
+		FileInMap *omap = gf_list_get(ctx->old_maps, i);
+		if ((data < omap->data) || (data >= omap->data + omap->size)) continue;
+		if (omap->nb_pck) omap->nb_pck--;
+		if (!omap->nb_pck) {
+			munmap(omap->data, (size_t) omap->size);
+			gf_list_rem(ctx->old_maps, i);
+			gf_free(omap);
+		}
+		break;
+	}
+	gf_mx_v(ctx->map_mx);
+}
+
+static void filein_map(GF_FileInCtx *ctx)
+{
+	void *map;
+	if (!ctx->mmap || (ctx->fd<0) || !ctx->file_size) return;
+	//cannot map the entire file in address space
+	if (ctx->file_size > (u64) (SIZE_MAX/2)) return;
+
+	map = mmap(NULL, (size_t) ctx->file_size, PROT_READ, MAP_SHARED, ctx->fd, 0);
+	if (map == MAP_FAILED) {
+		GF_LOG(GF_LOG_WARNING, GF_LOG_MMIO, ("[FileIn] Failed to map %s, using regular reads\n", ctx->src));
+		return;
+	}
+	if (!ctx->map_mx) ctx->map_mx = gf_mx_new("FileInMap");
+	ctx->map = map;
+	ctx->map_size = ctx->file_size;
+#ifdef MADV_SEQUENTIAL
+	madvise(ctx->map, (size_t) ctx->map_size, MADV_SEQUENTIAL);
+#endif
+}
+
+//hint the kernel about the next blocks to be dispatched
+static void filein_readahead(GF_FileInCtx *ctx)
+{
+	u64 start, len;
+	if (!ctx->readahead || (ctx->fd<0)) return;
+	start = ctx->file_pos;
+	len = (u64) ctx->readahead * ((ctx->map && ctx->map_block_size) ? ctx->map_block_size : ctx->block_size);
+	if (ctx->file_size && (start + len > ctx->file_size)) {
+		if (start >= ctx->file_size) return;
+		len = ctx->file_size - start;
+	}
+	if (!len) return;
+
+	if (ctx->map) {
+#ifdef MADV_WILLNEED
+		u64 page_size = (u64) sysconf(_SC_PAGESIZE);
+		u64 pstart = start - (start % page_size);
+		madvise(ctx->map + pstart, (size_t) (len + start - pstart), MADV_WILLNEED);
+#endif
+		return;
+	}
+#ifdef POSIX_FADV_WILLNEED
+	posix_fadvise(ctx->fd, (off_t) start, (off_t) len, POSIX_FADV_WILLNEED);
+#endif
+}
+#endif
+
 
 static GF_Err filein_initialize_ex(GF_Filter *filter)
 {
@@ -163,6 +288,7 @@ static GF_Err filein_initialize_ex(GF_Filter *filter)
 			prev_url = gf_fileio_url((GF_FileIO *)old_file);
 
 #ifdef GPAC_HAS_FD
+		filein_unmap(ctx);
 		if (ctx->fd>=0) {
 			close(ctx->fd);
 			ctx->fd = -1;
@@ -215,6 +341,11 @@ static GF_Err filein_initialize_ex(GF_Filter *filter)
 		struct stat sb;
 		fstat(ctx->fd, &sb);
 		ctx->file_size = sb.st_size;
+		filein_map(ctx);
+#ifdef POSIX_FADV_SEQUENTIAL
+		if (!ctx->map && ctx->readahead)
+			posix_fadvise(ctx->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
 	} else
 #endif
 		ctx->file_size = gf_fsize(ctx->file);
@@ -273,6 +404,18 @@ static void filein_finalize(GF_Filter *filter)
 
 	if (ctx->file) gf_fclose(ctx->file);
 #ifdef GPAC_HAS_FD
+	//session is being destroyed, packets still in flight are discarded
+	ctx->map_nb_pck = 0;
+	filein_unmap(ctx);
+	while (gf_list_count(ctx->old_maps)) {
+		FileInMap *omap = gf_list_pop_back(ctx->old_maps);
+		munmap(omap->data, (size_t) omap->size);
+		gf_free(omap);
+	}
+	gf_list_del(ctx->old_maps);
+	ctx->old_maps = NULL;
+	if (ctx->map_mx) gf_mx_del(ctx->map_mx);
+	ctx->map_mx = NULL;
 	if (ctx->fd>=0) close(ctx->fd);
 #endif
 	if (ctx->block) gf_free(ctx->block);
@@ -372,6 +515,14 @@ static Bool filein_process_event(GF_Filter *filter, const GF_FilterEvent *evt)
 		if (ctx->end_pos>ctx->file_size) ctx->end_pos = ctx->file_size;
 		ctx->range.num = evt->seek.start_offset;
 		ctx->range.den = ctx->end_pos;
+#ifdef GPAC_HAS_FD
+		//mapped data is dispatched in place, use the hinted size as is - the block buffer keeps its size
+		if (ctx->map && evt->seek.hint_block_size) {
+			ctx->map_block_size = evt->seek.hint_block_size;
+			filein_readahead(ctx);
+			return GF_TRUE;
+		}
+#endif
 		if (evt->seek.hint_block_size > ctx->block_size) {
 			ctx->block_size = evt->seek.hint_block_size;
 			ctx->block = gf_realloc(ctx->block, ctx->block_size+1);
@@ -399,6 +550,7 @@ static Bool filein_process_event(GF_Filter *filter, const GF_FilterEvent *evt)
 	case GF_FEVT_FILE_DELETE:
 		if (ctx->is_end && !strcmp(evt->file_del.url, "__gpac_self__")) {
 #ifdef GPAC_HAS_FD
+			filein_unmap(ctx);
 			if (ctx->fd>=0) {
 				close(ctx->fd);
 				ctx->fd = -1;
@@ -430,8 +582,10 @@ static void filein_pck_destructor(GF_Filter *filter, GF_FilterPid *pid, GF_Filte
 static GF_Err filein_process(GF_Filter *filter)
 {
 	GF_Err e;
-	u32 nb_read, to_read;
+	u32 nb_read, to_read, block_size;
 	u64 lto_read;
+	char *buf;
+	Bool in_map = GF_FALSE;
 	GF_FilterPacket *pck;
 	GF_FileInCtx *ctx = (GF_FileInCtx *) gf_filter_get_udta(filter);
 
@@ -527,20 +681,38 @@ static GF_Err filein_process(GF_Filter *filter)
 		return GF_OK;
 	}
 
+	block_size = ctx->block_size;
+#ifdef GPAC_HAS_FD
+	//mapped file, dispatch data in place once the PID is created (probing needs a null-terminated block)
+	if (ctx->map && ctx->pid && !ctx->do_reconfigure) {
+		in_map = GF_TRUE;
+		if (ctx->map_block_size) block_size = ctx->map_block_size;
+	}
+#endif
+
 	//compute size to read as u64 (large file)
 	if (ctx->end_pos > ctx->file_pos)
 		lto_read = ctx->end_pos - ctx->file_pos;
 	else if (ctx->file_size)
 		lto_read = ctx->file_size - ctx->file_pos;
 	else
-		lto_read = ctx->block_size;
+		lto_read = block_size;
 
 	//and clamp based on blocksize as u32
-	if (lto_read > (u64) ctx->block_size)
-		to_read = (u64) ctx->block_size;
+	if (lto_read > (u64) block_size)
+		to_read = (u64) block_size;
 	else
 		to_read = (u32) lto_read;
 
+	buf = ctx->block;
+#ifdef GPAC_HAS_FD
+	if (in_map) {
+		if (ctx->file_pos >= ctx->map_size) to_read = 0;
+		else if (ctx->file_pos + to_read > ctx->map_size) to_read = (u32) (ctx->map_size - ctx->file_pos);
+		nb_read = to_read;
+		buf = (char *) ctx->map + ctx->file_pos;
+	} else
+#endif
 	//force eof flush
 	if (!to_read) {
 #ifdef GPAC_HAS_FD
@@ -561,7 +733,8 @@ static GF_Err filein_process(GF_Filter *filter)
 			nb_read = (u32) gf_fread(ctx->block, to_read, ctx->file);
 	}
 
-	ctx->block[nb_read] = 0;
+	if (!in_map)
+		ctx->block[nb_read] = 0;
 	if (!ctx->pid || ctx->do_reconfigure) {
 		GF_FileIOCacheState cstate;
 		u64 fsize;
@@ -689,7 +862,18 @@ static GF_Err filein_process(GF_Filter *filter)
 	}
 
 	if (nb_read) {
-		pck = gf_filter_pck_new_shared(ctx->pid, ctx->block, nb_read, filein_pck_destructor);
+#ifdef GPAC_HAS_FD
+		//mapped data stays valid until its mapping is released, no need to wait for packet release
+		if (in_map) {
+			pck = gf_filter_pck_new_shared(ctx->pid, buf, nb_read, filein_map_pck_destructor);
+			if (pck) {
+				gf_mx_p(ctx->map_mx);
+				ctx->map_nb_pck++;
+				gf_mx_v(ctx->map_mx);
+			}
+		} else
+#endif
+			pck = gf_filter_pck_new_shared(ctx->pid, buf, nb_read, filein_pck_destructor);
 		if (!pck) return GF_OUT_OF_MEM;
 
 		gf_filter_pck_set_byte_offset(pck, ctx->file_pos);
@@ -697,8 +881,12 @@ static GF_Err filein_process(GF_Filter *filter)
 		gf_filter_pck_set_sap(pck, GF_FILTER_SAP_1);
 		ctx->file_pos += nb_read;
 
-		ctx->pck_out = GF_TRUE;
+		if (!in_map)
+			ctx->pck_out = GF_TRUE;
 		gf_filter_pck_send(pck);
+#ifdef GPAC_HAS_FD
+		filein_readahead(ctx);
+#endif
 	}
 
 	if (ctx->file_size && gf_filter_reporting_enabled(filter)) {
@@ -729,6 +917,8 @@ static const GF_FilterArgs FileInArgs[] =
 	{ OFFS(mime), "set file mime type", GF_PROP_NAME, NULL, NULL, 0},
 	{ OFFS(pck), "data to use instead of file", GF_PROP_DATA, NULL, NULL, 0},
 	{ OFFS(ptime), "timing for data packet, ignored if den is 0", GF_PROP_FRACTION, "0/0", NULL, 0},
+	{ OFFS(mmap), "memory-map local files and dispatch blocks referencing the mapped data", GF_PROP_BOOL, "false", NULL, GF_FS_ARG_HINT_EXPERT},
+	{ OFFS(readahead), "number of blocks to prefetch ahead of the current read position, 0 disables", GF_PROP_UINT, "0", NULL, GF_FS_ARG_HINT_EXPERT},
 	{0}
 };
 
@@ -755,6 +945,12 @@ GF_FilterRegister FileInRegister = {
 	"No specific properties are attached, except a timescale if (-ptime)[] is set.\n"
 	"EX gpac fin:pck=str@\"My Sample Text\":ptime=2500/100:#CodecID=stxt:#StreamType=text\n"
 	"This will declare the PID as WebVTT and send a single packet with payload `My Sample Text` and a timestamp value of 25 second.\n"
+	"\n"
+	"## Memory mapping\n"
+	"When [-mmap]() is set, local files are memory-mapped and blocks are dispatched without copy, several blocks being possibly in flight at once. Blocks are dispatched at the size hinted by the consuming filter, e.g. one frame per block for raw video.\n"
+	"The file must not be truncated while mapped.\n"
+	"The [-readahead]() option hints the system to prefetch the next blocks, with or without memory mapping.\n"
+	"EX gpac -i video.rgb:size=7680x4320:mmap:readahead=4 ...\n"
 	)
 	.private_size = sizeof(GF_FileInCtx),
 	.args = FileInArgs,
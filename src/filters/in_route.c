@@ -649,6 +649,8 @@ static GF_Err routein_initialize(GF_Filter *filter)
 		(ctx->fullseg ? GF_ROUTE_DISPATCH_FULL : GF_ROUTE_DISPATCH_PROGRESSIVE)
 	);
 	gf_route_dmx_set_reorder(ctx->route_dmx, ctx->reorder, ctx->rtimeout);
+	if (ctx->nbth)
+		gf_route_dmx_set_threads(ctx->route_dmx, ctx->nbth);
 
 	if (ctx->tsidbg) {
 		gf_route_dmx_debug_tsi(ctx->route_dmx, ctx->tsidbg);
@@ -723,6 +725,7 @@ static const GF_FilterArgs ROUTEInArgs[] =
 	{ OFFS(reorder), "consider packets are not always in order - if false, this will evaluate an LCT object as done when TOI changes", GF_PROP_BOOL, "true", NULL, GF_FS_ARG_HINT_EXPERT},
 	{ OFFS(cloop), "check for loops based on TOI (used for capture replay)", GF_PROP_BOOL, "false", NULL, 0},
 	{ OFFS(rtimeout), "default timeout in us to wait when gathering out-of-order packets", GF_PROP_UINT, "1000", NULL, GF_FS_ARG_HINT_EXPERT},
+	{ OFFS(nbth), "number of worker threads receiving and reassembling objects, services being distributed among threads while signaling and events remain on the filter thread (0 disables threading, ignored with network capture)", GF_PROP_UINT, "0", NULL, GF_FS_ARG_HINT_EXPERT},
 	{ OFFS(fullseg), "only dispatch full segments in cache mode (always true for other modes)", GF_PROP_BOOL, "false", NULL, GF_FS_ARG_HINT_ADVANCED},
 	{ OFFS(repair), "repair mode for corrupted files\n"
 		"- no: no repair is performed\n"
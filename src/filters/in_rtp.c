@@ -219,8 +219,10 @@ static void gf_rtp_switch_quality(GF_RTPIn *rtp, Bool switch_up)
 					gf_rtp_stop(cur_stream->rtp_ch);
 					cur_stream->status = RTP_Connected;
 					rtp->cur_mid = stream->mid;
-					if (cur_stream->opid)
+					if (cur_stream->opid) {
+						rtpin_stream_flush_au(cur_stream);
 						gf_filter_pid_set_eos(cur_stream->opid);
+					}
 					break;
 				}
 			}
@@ -711,6 +713,7 @@ static GF_Err rtpin_process(GF_Filter *filter)
 					gf_filter_pck_send(pck);
 				}
 			}
+			rtpin_stream_flush_au(stream);
 			gf_filter_pid_set_eos(stream->opid);
 			stream->flags |= RTP_EOS_FLUSHED;
 			nb_eos++;
@@ -723,6 +726,7 @@ static GF_Err rtpin_process(GF_Filter *filter)
 				i=0;
 				while ((stream = (GF_RTPInStream *)gf_list_enum(ctx->streams, &i))) {
 					if (! (stream->flags & RTP_EOS_FLUSHED)) {
+						rtpin_stream_flush_au(stream);
 						gf_filter_pid_set_eos(stream->opid);
 						stream->flags |= RTP_EOS_FLUSHED;
 					}
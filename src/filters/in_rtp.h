@@ -291,6 +291,11 @@ struct __rtpin_stream
 	Bool first_in_rtp_pck;
 	GF_List *pck_queue;
 
+	//access unit being reassembled from depacketizer fragments, sent once complete
+	GF_FilterPacket *au_pck;
+	//allocated size of au_pck, and decaying max of previous AU sizes used to preallocate the next one
+	u32 au_alloc, au_size_hint;
+
 	/*stream id*/
 	u32 mid;
 
@@ -323,6 +328,8 @@ void rtpin_stream_del(GF_RTPInStream *stream);
 GF_Err rtpin_stream_init(GF_RTPInStream *stream, Bool ResetOnly);
 
 void rtpin_stream_reset_queue(GF_RTPInStream *stream);
+/*sends pending access unit if any*/
+void rtpin_stream_flush_au(GF_RTPInStream *stream);
 
 /*RTSP -> RTP de-interleaving callback*/
 GF_Err rtpin_rtsp_data_cbk(GF_RTSPSession *sess, void *cbck, u8 *buffer, u32 bufferSize, Bool IsRTCP);
@@ -75,6 +75,10 @@ GF_Err rtpin_stream_init(GF_RTPInStream *stream, Bool ResetOnly)
 
 void rtpin_stream_reset_queue(GF_RTPInStream *stream)
 {
+	if (stream->au_pck) {
+		gf_filter_pck_discard(stream->au_pck);
+		stream->au_pck = NULL;
+	}
 	if (!stream->pck_queue) return;
 	while (gf_list_count(stream->pck_queue)) {
 		GF_FilterPacket *pck = gf_list_pop_back(stream->pck_queue);
@@ -99,10 +103,8 @@ void rtpin_stream_del(GF_RTPInStream *stream)
 	if (stream->control) gf_free(stream->control);
 	if (stream->session_id) gf_free(stream->session_id);
 	if (stream->buffer) gf_free(stream->buffer);
-	if (stream->pck_queue) {
-		rtpin_stream_reset_queue(stream);
-		gf_list_del(stream->pck_queue);
-	}
+	rtpin_stream_reset_queue(stream);
+	if (stream->pck_queue) gf_list_del(stream->pck_queue);
 	gf_free(stream);
 }
 
@@ -130,10 +132,55 @@ static void rtpin_stream_queue_pck(GF_RTPInStream *stream, GF_FilterPacket *pck,
 	}
 }
 
+void rtpin_stream_flush_au(GF_RTPInStream *stream)
+{
+	u32 size;
+	GF_FilterPacket *pck = stream->au_pck;
+	if (!pck) return;
+	stream->au_pck = NULL;
+
+	gf_filter_pck_get_data(pck, &size);
+	if (size > stream->au_size_hint) stream->au_size_hint = size;
+	else stream->au_size_hint -= (stream->au_size_hint - size) / 16;
+
+	gf_filter_pck_send(pck);
+}
+
+//append a fragment to the pending access unit, sending it if complete
+static void rtpin_stream_append_au(GF_RTPInStream *stream, u8 *payload, u32 size, GF_SLHeader *hdr)
+{
+	u8 *data;
+	u32 au_size;
+	Bool is_start, is_end;
+	GF_FilterPacket *pck = stream->au_pck;
+
+	gf_filter_pck_get_data(pck, &au_size);
+	//expand reallocates to the exact size, reserve more space to avoid reallocating for each fragment
+	if (au_size + size > stream->au_alloc) {
+		u32 new_alloc = MAX(2*stream->au_alloc, au_size + size);
+		if (gf_filter_pck_expand(pck, new_alloc - au_size, &data, NULL, NULL) != GF_OK) return;
+		gf_filter_pck_truncate(pck, au_size);
+		stream->au_alloc = new_alloc;
+	}
+	if (gf_filter_pck_expand(pck, size, NULL, &data, NULL) != GF_OK) return;
+	memcpy(data, payload, size);
+
+	if (hdr->randomAccessPointFlag)
+		gf_filter_pck_set_sap(pck, GF_FILTER_SAP_1);
+	if (stream->rtp_ch->packet_loss)
+		gf_filter_pck_set_corrupted(pck, 1);
+
+	gf_filter_pck_get_framing(pck, &is_start, &is_end);
+	gf_filter_pck_set_framing(pck, is_start, hdr->accessUnitEndFlag);
+	if (hdr->accessUnitEndFlag)
+		rtpin_stream_flush_au(stream);
+}
+
 static void rtp_sl_packet_cbk(void *udta, u8 *payload, u32 size, GF_SLHeader *hdr, GF_Err e)
 {
 	u64 cts, dts;
 	s64 diff;
+	u32 alloc_size;
 	GF_FilterPacket *pck;
 	u8 *pck_data;
 	GF_RTPInStream *stream = (GF_RTPInStream *)udta;
@@ -183,10 +230,30 @@ static void rtp_sl_packet_cbk(void *udta, u8 *payload, u32 size, GF_SLHeader *hd
 		stream->prev_cts = (u32) hdr->compositionTimeStamp;
 	}
 
+	//gather fragments of the same AU in a single packet, unless a new config must be signaled first
+	if (stream->au_pck) {
+		if (!hdr->accessUnitStartFlag
+			&& !stream->depacketizer->sl_map.config_updated
+			&& (gf_filter_pck_get_cts(stream->au_pck) == hdr->compositionTimeStamp - stream->ts_offset)
+		) {
+			rtpin_stream_append_au(stream, payload, size, hdr);
+			hdr->compositionTimeStamp = cts;
+			hdr->decodingTimeStamp = dts;
+			return;
+		}
+		rtpin_stream_flush_au(stream);
+	}
+
+	alloc_size = size;
+	//AU is fragmented, allocate from previous AU sizes
+	if (!hdr->accessUnitEndFlag && !stream->depacketizer->sl_map.IndexDeltaLength && (stream->au_size_hint > size))
+		alloc_size = stream->au_size_hint;
 
-	pck = gf_filter_pck_new_alloc(stream->opid, size, &pck_data);
+	pck = gf_filter_pck_new_alloc(stream->opid, alloc_size, &pck_data);
 	if (!pck) return;
-	
+	if (alloc_size > size)
+		gf_filter_pck_truncate(pck, size);
+
 	memcpy(pck_data, payload, size);
 	if (hdr->decodingTimeStampFlag)
 		gf_filter_pck_set_dts(pck, hdr->decodingTimeStamp - stream->ts_offset);
@@ -265,7 +332,10 @@ static void rtp_sl_packet_cbk(void *udta, u8 *payload, u32 size, GF_SLHeader *hd
 	if (stream->depacketizer->sl_map.IndexDeltaLength) {
 		rtpin_stream_queue_pck(stream, pck, hdr->compositionTimeStamp+stream->ts_offset);
 	} else {
-		gf_filter_pck_send(pck);
+		stream->au_pck = pck;
+		stream->au_alloc = alloc_size;
+		if (hdr->accessUnitEndFlag)
+			rtpin_stream_flush_au(stream);
 	}
 
 	hdr->compositionTimeStamp = cts;
@@ -644,6 +714,7 @@ void rtpin_stream_on_rtp_pck(GF_RTPInStream *stream, char *pck, u32 size)
 		if (ABSDIFF(stream->range_end, (ts + stream->current_start + gf_rtp_get_current_time(stream->rtp_ch)) ) < 0.2) {
 			stream->flags |= RTP_EOS;
 			stream->stat_stop_time = gf_sys_clock();
+			rtpin_stream_flush_au(stream);
 			gf_filter_pid_set_eos(stream->opid);
 		}
 	}
@@ -741,9 +812,12 @@ GF_Err rtpin_rtsp_data_cbk(GF_RTSPSession *sess, void *cbk, u8 *buffer, u32 buff
 
 
 
+//maximum number of RTP packets read in a row on a stream once its socket is ready
+#define RTP_MAX_READ_BATCH	32
+
 u32 rtpin_stream_read(GF_RTPInStream *stream)
 {
-	u32 size, tot_size = 0;
+	u32 i, size, tot_size = 0;
 
 	if (!stream->rtp_ch) return 0;
 	if (gf_sk_group_sock_is_set(stream->rtpin->sockgroup, stream->rtp_ch->rtcp, GF_SK_SELECT_READ)) {
@@ -756,10 +830,13 @@ u32 rtpin_stream_read(GF_RTPInStream *stream)
 	}
 
 	if (gf_sk_group_sock_is_set(stream->rtpin->sockgroup, stream->rtp_ch->rtp, GF_SK_SELECT_READ)) {
-		size = gf_rtp_read_rtp(stream->rtp_ch, stream->buffer, stream->rtpin->block_size);
-		if (size) {
+		//drain the socket rather than going through a group select for each packet
+		for (i=0; i<RTP_MAX_READ_BATCH; i++) {
+			size = gf_rtp_read_rtp(stream->rtp_ch, stream->buffer, stream->rtpin->block_size);
+			if (!size) break;
 			tot_size += size;
 			rtpin_stream_on_rtp_pck(stream, stream->buffer, size);
+			if (stream->flags & RTP_EOS) break;
 		}
 		stream->rtpin->eos_probe_start = 0;
 	}
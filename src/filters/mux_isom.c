@@ -296,7 +296,7 @@ typedef struct
 	Bool sseg;
 	Bool noroll, norap;
 	Bool saio32, tfdt64;
-	u32 compress;
+	u32 compress, clevel, cstrat;
 	Bool trun_inter;
 	Bool truns_first;
 	char *boxpatch;
@@ -6403,15 +6403,39 @@ GF_Err mp4mx_reload_output(GF_MP4MuxCtx *ctx)
 #ifndef GPAC_DISABLE_ISOM_FRAGMENTS
 static void mp4_process_id3(GF_MovieFragmentBox *moof, const GF_PropertyValue *emsg_prop)
 {
-	GF_BitStream *bs = gf_bs_new(emsg_prop->value.data.ptr, emsg_prop->value.data.size, GF_BITSTREAM_READ);
-	GF_EventMessageBox *emsg = (GF_EventMessageBox *)gf_isom_box_new(GF_ISOM_BOX_TYPE_EMSG);
+	u32 i, count, timescale, data_length;
+	u64 pts_delta;
+	GF_EventMessageBox *emsg;
+	GF_BitStream *bs;
+
+	if (emsg_prop->value.data.size < 16) return;
+
+	bs = gf_bs_new(emsg_prop->value.data.ptr, 16, GF_BITSTREAM_READ);
+	timescale = gf_bs_read_u32(bs);   // timescale
+	pts_delta = gf_bs_read_u64(bs);   // presentation time delta
+	data_length = gf_bs_read_u32(bs); // message data length
+	gf_bs_del(bs);
+
+	if (data_length > emsg_prop->value.data.size - 16) {
+		GF_LOG(GF_LOG_WARNING, GF_LOG_FILTER, ("Got less bytes than expected when reading ID3 data, expecting %u, got %u\n", data_length, emsg_prop->value.data.size - 16))
+		data_length = emsg_prop->value.data.size - 16;
+	}
 
-	u32 timescale = gf_bs_read_u32(bs);   // timescale
-	u64 pts_delta = gf_bs_read_u64(bs);   // presentation time delta
-	u32 data_length = gf_bs_read_u32(bs); // message data length
+	// insert only if its presentation time is not already present, checked before creating the box
+	count = gf_list_count(moof->emsgs);
+	for (i=0; i<count; i++) {
+		GF_EventMessageBox *existing_emsg = gf_list_get(moof->emsgs, i);
+		if (existing_emsg->scheme_id_uri && !strcmp(existing_emsg->scheme_id_uri, "https://aomedia.org/emsg/ID3")
+			&& existing_emsg->value && !strcmp(existing_emsg->value, "www.nielsen.com:id3:v1")
+			&& (existing_emsg->presentation_time_delta == pts_delta)
+		) {
+			return;
+		}
+	}
 
+	emsg = (GF_EventMessageBox *)gf_isom_box_new(GF_ISOM_BOX_TYPE_EMSG);
+	if (!emsg) return;
 	emsg->version = 1;
-	
 	emsg->timescale = timescale;
 	emsg->presentation_time_delta = pts_delta;
 	emsg->event_duration = 0xFFFFFFFF;
@@ -6419,32 +6443,17 @@ static void mp4_process_id3(GF_MovieFragmentBox *moof, const GF_PropertyValue *e
 	emsg->scheme_id_uri = gf_strdup("https://aomedia.org/emsg/ID3");
 	emsg->value = gf_strdup("www.nielsen.com:id3:v1");
 
+	//original ID3 payload is written as is
 	emsg->message_data_size = data_length;
-	emsg->message_data = (u8 *)gf_malloc(emsg->message_data_size);
-
-	u32 read = gf_bs_read_data(bs, emsg->message_data, emsg->message_data_size);
-	if (read != emsg->message_data_size)
-		GF_LOG(GF_LOG_WARNING, GF_LOG_FILTER, ("Got less bytes than expected when reading ID3 data, expecting %u, got %u\n", emsg->message_data_size, read))
-
-	gf_bs_del(bs);
-
-	// insert only if its presentation time is not already present
-	u32 insert_emsg = GF_TRUE;
-	for (int i=0; i<gf_list_count(moof->emsgs); ++i)
-	{
-		GF_EventMessageBox *existing_emsg = gf_list_get(moof->emsgs, i);
-		if (!strcmp(existing_emsg->scheme_id_uri, "https://aomedia.org/emsg/ID3") && !strcpy(existing_emsg->value, "www.nielsen.com:id3:v1")) {
-			if (existing_emsg->presentation_time_delta == emsg->presentation_time_delta) {
-				insert_emsg = GF_FALSE;
-				break;
-			}
-		}
+	emsg->message_data = (u8 *)gf_malloc(data_length);
+	if (!emsg->message_data) {
+		gf_isom_box_del((GF_Box *)emsg);
+		return;
 	}
+	memcpy(emsg->message_data, emsg_prop->value.data.ptr + 16, data_length);
 
-	if (insert_emsg == GF_TRUE) {
-		if (!moof->emsgs) moof->emsgs = gf_list_new();
-		gf_list_add(moof->emsgs, emsg);
-	}
+	if (!moof->emsgs) moof->emsgs = gf_list_new();
+	gf_list_add(moof->emsgs, emsg);
 }
 #endif
 
@@ -7831,6 +7840,7 @@ static GF_Err mp4_mux_initialize(GF_Filter *filter)
 		if (ctx->fcomp) flags |= GF_ISOM_COMP_FORCE_ALL;
 		if (ctx->otyp) flags |= GF_ISOM_COMP_WRAP_FTYPE;
 		gf_isom_enable_compression(ctx->file, ctx->compress, flags);
+		gf_isom_set_compression_level(ctx->file, ctx->clevel, ctx->cstrat);
 	}
 
 	if ((ctx->store>=MP4MX_MODE_FRAG) && !ctx->tsalign)
@@ -8399,6 +8409,13 @@ static const GF_FilterArgs MP4MuxArgs[] =
 						"- sidx: compress moof and sidx boxes\n"
 						"- ssix: compress moof, sidx and ssix boxes\n"
 						"- all: compress moov, moof, sidx and ssix boxes", GF_PROP_UINT, "no", "no|moov|moof|sidx|ssix|all", GF_FS_ARG_HINT_EXPERT},
+	{ OFFS(clevel), "zlib level for top-level box compression, lower values reduce compression latency", GF_PROP_UINT, "9", "0-9", GF_FS_ARG_HINT_EXPERT},
+	{ OFFS(cstrat), "zlib strategy for top-level box compression\n"
+						"- def: default strategy\n"
+						"- filter: filtered strategy\n"
+						"- huff: Huffman encoding only\n"
+						"- rle: run-length encoding\n"
+						"- fixed: fixed Huffman codes", GF_PROP_UINT, "def", "def|filter|huff|rle|fixed", GF_FS_ARG_HINT_EXPERT},
 	{ OFFS(fcomp), "force using compress box even when compressed size is larger than uncompressed", GF_PROP_BOOL, "false", NULL, GF_FS_ARG_HINT_EXPERT},
 	{ OFFS(otyp), "inject original file type when using compressed boxes", GF_PROP_BOOL, "false", NULL, GF_FS_ARG_HINT_EXPERT},
 
@@ -8466,7 +8483,7 @@ GF_FilterRegister MP4MuxRegister = {
 	"The [-vodcache]() option allows controlling how DASH onDemand segments are generated:\n"
 	"- If set to `on`, file data is stored to a temporary file on disk and flushed upon completion, no padding is present.\n"
 	"- If set to `insert`, SIDX/SSIX will be injected upon completion of the file by shifting bytes in file. In this case, no padding is required but this might not be compatible with all output sinks and will take longer to write the file.\n"
-	"- If set to `replace`, SIDX/SSIX size will be estimated based on duration and DASH segment length, and padding will be used in the file __before__ the final SIDX. If input PIDs have the properties `DSegs` set, this will used be as the number of segments.\n"
+	"- If set to `replace`, SIDX/SSIX size will be estimated based on duration and DASH segment length, and padding will be used in the file __before__ the final SIDX. If input PIDs have the properties `DSegs` set (from DASH cues, or computed by the dasher from local ISOBMFF sources), this will used be as the number of segments and the file will be written in a single pass without padding estimation.\n"
 	"The `on` and `insert` modes will produce exactly the same file, while the mode `replace` may inject a `free` box before the sidx.\n"
 	"  \n"
 	"# Custom boxes\n"
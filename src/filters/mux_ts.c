@@ -122,10 +122,9 @@ typedef struct
 	u32 last_log_time;
 	Bool pmt_update_pending;
 
-	//SCTE-35 data is conveyed by packet properties
+	//SCTE-35 data is conveyed by packet properties, we keep a reference to the source packet properties until the section is built
 	GF_M2TS_Mux_Stream *scte35_stream;
-	u8 *scte35_payload;
-	u32 scte35_size;
+	GF_FilterPacket *scte35_pck;
 
 	u32 dash_mode;
 	Bool init_dash;
@@ -406,12 +405,16 @@ static u32 tsmux_stream_process_scte35(GF_M2TS_Mux *muxer, GF_M2TS_Mux_Stream *s
 {
 	if (stream->table_needs_update) { /* generate table payload */
 		GF_TSMuxCtx *ctx = ((M2Pid*)stream->ifce->input_udta)->ctx;
-		gf_m2ts_mux_table_update(stream, GF_M2TS_TABLE_ID_SCTE35_SPLICE_INFO, stream->program->number,
-			ctx->scte35_payload+3, ctx->scte35_size-3, // remove redundancy since payload already contains an entire SCTE 35 splice_info_section
-			GF_FALSE, GF_FALSE);
-		ctx->scte35_size = 0;
-		gf_free(ctx->scte35_payload);
-		ctx->scte35_payload = NULL;
+		const GF_PropertyValue *p = ctx->scte35_pck ? gf_filter_pck_get_property_str(ctx->scte35_pck, "scte35") : NULL;
+		if (p && (p->value.data.size>3)) {
+			gf_m2ts_mux_table_update(stream, GF_M2TS_TABLE_ID_SCTE35_SPLICE_INFO, stream->program->number,
+				p->value.data.ptr+3, p->value.data.size-3, // remove redundancy since payload already contains an entire SCTE 35 splice_info_section
+				GF_FALSE, GF_FALSE);
+		}
+		if (ctx->scte35_pck) {
+			gf_filter_pck_unref(ctx->scte35_pck);
+			ctx->scte35_pck = NULL;
+		}
 
 		stream->table_needs_update = GF_FALSE;
 		stream->table_needs_send = GF_TRUE;
@@ -661,14 +664,20 @@ static GF_Err tsmux_esi_ctrl(GF_ESInterface *ifce, u32 act_type, void *param)
 		es_pck.cts += tspid->max_media_skip + tspid->media_delay;
 
 		p = gf_filter_pck_get_property_str(pck, "scte35");
-		if (p) {
-			gf_assert(tspid->ctx->scte35_stream);
-			gf_assert(!tspid->ctx->scte35_payload);
-			tspid->ctx->scte35_payload = gf_malloc(p->value.data.size);
-			memcpy(tspid->ctx->scte35_payload, p->value.data.ptr, p->value.data.size);
-			tspid->ctx->scte35_size = p->value.data.size;
-			tspid->ctx->scte35_stream->table_needs_update = GF_TRUE;
-			tspid->ctx->scte35_stream->table_needs_send = GF_TRUE;
+		if (p && tspid->ctx->scte35_stream) {
+			GF_FilterPacket *ref = pck;
+			//section not yet sent, replace it
+			if (tspid->ctx->scte35_pck) {
+				GF_LOG(GF_LOG_WARNING, GF_LOG_CONTAINER, ("[M2TSMux] SCTE-35 section received before previous one was sent, replacing\n"));
+				gf_filter_pck_unref(tspid->ctx->scte35_pck);
+				tspid->ctx->scte35_pck = NULL;
+			}
+			//no copy of the section, keep a reference to the packet properties
+			if (gf_filter_pck_ref_props(&ref)==GF_OK) {
+				tspid->ctx->scte35_pck = ref;
+				tspid->ctx->scte35_stream->table_needs_update = GF_TRUE;
+				tspid->ctx->scte35_stream->table_needs_send = GF_TRUE;
+			}
 		}
 
 		if (tspid->nb_repeat_last) {
@@ -2047,6 +2056,7 @@ static void tsmux_finalize(GF_Filter *filter)
 	}
 	gf_list_del(ctx->pids);
 	gf_m2ts_mux_del(ctx->mux);
+	if (ctx->scte35_pck) gf_filter_pck_unref(ctx->scte35_pck);
 	if (ctx->pack_buffer) gf_free(ctx->pack_buffer);
 	if (ctx->sidx_entries) gf_free(ctx->sidx_entries);
 	if (ctx->idx_bs) gf_bs_del(ctx->idx_bs);
@@ -108,7 +108,7 @@ typedef struct
 #endif
 	GF_PropStringList rdirs;
 	Bool close, hold, quit, post, dlist, ice, reopen, blockio;
-	u32 port, block_size, maxc, maxp, timeout, hmode, sutc, cors, max_client_errors, max_async_buf, ka, zmax;
+	u32 port, block_size, maxc, maxp, timeout, hmode, sutc, cors, max_client_errors, max_async_buf, ka, zmax, srange;
 	s32 max_cache_segs;
 	GF_PropStringList hdrs;
 
@@ -147,6 +147,13 @@ typedef struct
 	GF_List *directories;
 	Bool has_read_dir, has_write_dir;
 
+	//segment index maps of served files, most recent last
+	GF_List *seg_maps;
+
+	//framed chunk of the packet being written, shared by all chunk-transfer sessions
+	u8 *chunk_buf;
+	u32 chunk_buf_alloc;
+
 
 #ifdef GPAC_HAS_QJS
 	JSContext *jsc;
@@ -221,6 +228,20 @@ typedef struct
 	s64 end;
 } HTTByteRange;
 
+//max size of chunk header (32 bit size in hex + CRLF)
+#define HTTPOUT_CHUNK_HDR_MAX	10
+//space to reserve around chunk payload for chunk header and CRLF trailer
+#define HTTPOUT_CHUNK_OVERHEAD	(HTTPOUT_CHUNK_HDR_MAX+2)
+
+typedef struct
+{
+	char *path;
+	u64 file_size, last_modif;
+	//byte offset of each subsegment start, last entry is the end of the last subsegment
+	u64 *offsets;
+	u32 nb_offsets;
+} HTTPSegmentMap;
+
 struct __httpout_session {
 	GF_HTTPOutCtx *ctx;
 
@@ -243,6 +264,8 @@ struct __httpout_session {
 	u64 req_start_time;
 	u64 last_active_time;
 	Bool file_in_progress;
+	//file position must be restored before next read (data pushed by writer or file grown)
+	Bool resource_seek_pending;
 	Bool use_chunk_transfer;
 	u32 put_in_progress;
 	//for upload only: 0 not an upload, 1 creation, 2: update
@@ -272,6 +295,10 @@ struct __httpout_session {
 
 	u8 *comp_data;
 
+	//single read buffer for byte ranges matching subsegment boundaries
+	u8 *range_buf;
+	u32 range_buf_size, range_read_size;
+
 #ifdef GPAC_HAS_QJS
 	JSValue obj;
 #endif
@@ -763,6 +790,189 @@ static void httpout_set_local_path(GF_HTTPOutCtx *ctx, GF_HTTPOutInput *in)
         gf_dynstrcat(&in->local_path, in->path, NULL);
 }
 
+//write chunk header before payload and CRLF after it, payload must have HTTPOUT_CHUNK_HDR_MAX bytes before and 2 bytes after
+static u8 *httpout_frame_chunk(u8 *payload, u32 size, u32 *chunk_size)
+{
+	char szHdr[HTTPOUT_CHUNK_HDR_MAX+1];
+	u32 len;
+	sprintf(szHdr, "%X\r\n", size);
+	len = (u32) strlen(szHdr);
+	memcpy(payload - len, szHdr, len);
+	payload[size] = '\r';
+	payload[size+1] = '\n';
+	*chunk_size = len + size + 2;
+	return payload - len;
+}
+
+#define HTTPOUT_MAX_SEG_MAPS	20
+//hard limit of per-session subsegment range buffer, regardless of srange
+#define HTTPOUT_MAX_SRANGE	8000000
+
+static void httpout_del_segment_map(HTTPSegmentMap *smap)
+{
+	if (smap->offsets) gf_free(smap->offsets);
+	gf_free(smap->path);
+	gf_free(smap);
+}
+
+//locate the first top-level sidx of an ISOBMFF file and build the subsegment offset table
+static void httpout_load_segment_map(HTTPSegmentMap *smap)
+{
+	u8 hdr[16];
+	u64 pos = 0;
+	FILE *f = gf_fopen(smap->path, "rb");
+	if (!f) return;
+
+	while (pos + 8 <= smap->file_size) {
+		u64 size;
+		u32 type, hdr_size = 8;
+		gf_fseek(f, pos, SEEK_SET);
+		if (gf_fread(hdr, 8, f) != 8) break;
+		size = GF_4CC(hdr[0], hdr[1], hdr[2], hdr[3]);
+		type = GF_4CC(hdr[4], hdr[5], hdr[6], hdr[7]);
+		if (size==1) {
+			if (gf_fread(hdr+8, 8, f) != 8) break;
+			size = ((u64) GF_4CC(hdr[8], hdr[9], hdr[10], hdr[11]) << 32) | GF_4CC(hdr[12], hdr[13], hdr[14], hdr[15]);
+			hdr_size = 16;
+		} else if (!size) {
+			size = smap->file_size - pos;
+		}
+		if ((size < hdr_size) || (pos + size > smap->file_size)) break;
+
+		if (type==GF_4CC('s','i','d','x')) {
+			u8 *data;
+			GF_BitStream *bs;
+			u32 i, version, nb_refs;
+			u64 offset;
+			//cap sidx size, we only need it for byte range hints
+			if (size > 0xFFFFFF) break;
+			data = gf_malloc((u32) (size - hdr_size));
+			if (!data) break;
+			if (gf_fread(data, (u32) (size - hdr_size), f) != size - hdr_size) {
+				gf_free(data);
+				break;
+			}
+			bs = gf_bs_new(data, size - hdr_size, GF_BITSTREAM_READ);
+			version = gf_bs_read_u8(bs);
+			gf_bs_read_int(bs, 24);
+			//reference ID and timescale
+			gf_bs_read_u32(bs);
+			gf_bs_read_u32(bs);
+			if (version) {
+				gf_bs_read_u64(bs);
+				offset = gf_bs_read_u64(bs);
+			} else {
+				gf_bs_read_u32(bs);
+				offset = gf_bs_read_u32(bs);
+			}
+			gf_bs_read_u16(bs);
+			nb_refs = gf_bs_read_u16(bs);
+			offset += pos + size;
+			if (nb_refs && (gf_bs_available(bs) >= 12 * (u64) nb_refs)) {
+				smap->offsets = gf_malloc(sizeof(u64) * (nb_refs+1));
+				if (smap->offsets) {
+					smap->offsets[0] = offset;
+					for (i=0; i<nb_refs; i++) {
+						//reference type and size, duration, SAP info
+						offset += gf_bs_read_u32(bs) & 0x7FFFFFFF;
+						gf_bs_read_u32(bs);
+						gf_bs_read_u32(bs);
+						smap->offsets[i+1] = offset;
+					}
+					smap->nb_offsets = nb_refs+1;
+					if (offset > smap->file_size) {
+						gf_free(smap->offsets);
+						smap->offsets = NULL;
+						smap->nb_offsets = 0;
+					}
+				}
+			}
+			gf_bs_del(bs);
+			gf_free(data);
+			break;
+		}
+		//media data before any sidx, not indexed
+		if ((type==GF_4CC('m','o','o','f')) || (type==GF_4CC('m','d','a','t'))) break;
+		pos += size;
+	}
+	gf_fclose(f);
+}
+
+static HTTPSegmentMap *httpout_get_segment_map(GF_HTTPOutCtx *ctx, const char *path, u64 file_size, u64 last_modif)
+{
+	HTTPSegmentMap *smap;
+	u32 i, count = gf_list_count(ctx->seg_maps);
+	for (i=0; i<count; i++) {
+		smap = gf_list_get(ctx->seg_maps, i);
+		if (strcmp(smap->path, path)) continue;
+		gf_list_rem(ctx->seg_maps, i);
+		//file changed, reload
+		if ((smap->file_size != file_size) || (smap->last_modif != last_modif)) {
+			httpout_del_segment_map(smap);
+			break;
+		}
+		gf_list_add(ctx->seg_maps, smap);
+		return smap;
+	}
+	GF_SAFEALLOC(smap, HTTPSegmentMap);
+	if (!smap) return NULL;
+	smap->path = gf_strdup(path);
+	smap->file_size = file_size;
+	smap->last_modif = last_modif;
+	httpout_load_segment_map(smap);
+
+	if (gf_list_count(ctx->seg_maps) >= HTTPOUT_MAX_SEG_MAPS) {
+		HTTPSegmentMap *old = gf_list_pop_front(ctx->seg_maps);
+		httpout_del_segment_map(old);
+	}
+	gf_list_add(ctx->seg_maps, smap);
+	return smap;
+}
+
+static Bool httpout_segment_map_has_offset(HTTPSegmentMap *smap, u64 offset)
+{
+	u32 lo = 0, hi = smap->nb_offsets;
+	while (lo < hi) {
+		u32 mid = (lo + hi) / 2;
+		if (smap->offsets[mid] == offset) return GF_TRUE;
+		if (smap->offsets[mid] < offset) lo = mid+1;
+		else hi = mid;
+	}
+	return GF_FALSE;
+}
+
+//check if a single closed range of a static file maps to whole subsegments, in which case it is read and sent at once
+static void httpout_check_subsegment_range(GF_HTTPOutSession *sess)
+{
+	HTTPSegmentMap *smap;
+	u64 start, end;
+	sess->range_read_size = 0;
+	if (!sess->ctx->srange || (sess->nb_ranges != 1) || sess->in_source || sess->file_in_progress || sess->put_in_progress)
+		return;
+	if ((sess->bytes_in_req <= sess->ctx->block_size) || (sess->bytes_in_req > MIN(sess->ctx->srange, HTTPOUT_MAX_SRANGE)))
+		return;
+	if (!sess->path || !strncmp(sess->path, "gfio://", 7))
+		return;
+
+	smap = httpout_get_segment_map(sess->ctx, sess->path, sess->file_size, sess->last_file_modif);
+	if (!smap || !smap->nb_offsets) return;
+
+	start = sess->ranges[0].start;
+	end = sess->ranges[0].end + 1;
+	if (!httpout_segment_map_has_offset(smap, start) || !httpout_segment_map_has_offset(smap, end))
+		return;
+
+	if (sess->range_buf_size < sess->bytes_in_req) {
+		sess->range_buf = gf_realloc(sess->range_buf, (u32) sess->bytes_in_req);
+		if (!sess->range_buf) {
+			sess->range_buf_size = 0;
+			return;
+		}
+		sess->range_buf_size = (u32) sess->bytes_in_req;
+	}
+	sess->range_read_size = (u32) sess->bytes_in_req;
+}
+
 static Bool httpout_sess_parse_range(GF_HTTPOutSession *sess, char *range)
 {
 	Bool request_ok = GF_TRUE;
@@ -773,6 +983,7 @@ static Bool httpout_sess_parse_range(GF_HTTPOutSession *sess, char *range)
 	sess->nb_ranges = 0;
 	sess->nb_bytes = 0;
 	sess->range_idx = 0;
+	sess->range_read_size = 0;
 	if (!range) return GF_TRUE;
 
 	if (sess->in_source && !sess->ctx->has_read_dir)
@@ -913,6 +1124,8 @@ static Bool httpout_sess_parse_range(GF_HTTPOutSession *sess, char *range)
 	sess->file_pos = sess->ranges[0].start;
 	if (sess->resource)
 		gf_fseek(sess->resource, sess->file_pos, SEEK_SET);
+
+	httpout_check_subsegment_range(sess);
 	return GF_TRUE;
 }
 
@@ -1542,7 +1755,7 @@ static void httpout_sess_io(void *usr_cbk, GF_NETIO_Parameter *parameter)
 			goto exit;
 		}
 		if (!sess->buffer) {
-			sess->buffer = gf_malloc(sizeof(u8)*sess->ctx->block_size);
+			sess->buffer = gf_malloc(sizeof(u8)*(sess->ctx->block_size + HTTPOUT_CHUNK_OVERHEAD));
 		}
 		if (gf_list_find(sess->ctx->active_sessions, sess)<0) {
 			gf_list_add(sess->ctx->active_sessions, sess);
@@ -2153,7 +2366,7 @@ static void httpout_sess_io(void *usr_cbk, GF_NETIO_Parameter *parameter)
 
 	if (url) gf_free(url);
 	if (!sess->buffer) {
-		sess->buffer = gf_malloc(sizeof(u8)*sess->ctx->block_size);
+		sess->buffer = gf_malloc(sizeof(u8)*(sess->ctx->block_size + HTTPOUT_CHUNK_OVERHEAD));
 	}
 	if (response_body) {
 		gf_free(response_body);
@@ -2256,7 +2469,7 @@ exit:
 			sess->use_chunk_transfer=GF_TRUE;
 		}
 		if (!sess->buffer) {
-			sess->buffer = gf_malloc(sizeof(u8)*sess->ctx->block_size);
+			sess->buffer = gf_malloc(sizeof(u8)*(sess->ctx->block_size + HTTPOUT_CHUNK_OVERHEAD));
 		}
 		sess->is_h2 = gf_dm_sess_is_h2(sess->http_sess);
 	}
@@ -2854,6 +3067,7 @@ static GF_Err httpout_initialize(GF_Filter *filter)
 	ctx->sessions = gf_list_new();
 	ctx->active_sessions = gf_list_new();
 	ctx->inputs = gf_list_new();
+	ctx->seg_maps = gf_list_new();
 	ctx->filter = filter;
 	//used in both server and push modes
 	ctx->sg = gf_sk_group_new();
@@ -2996,6 +3210,7 @@ static void httpout_del_session(GF_HTTPOutSession *s)
 	if (s->http_sess)
 		httpout_close_session(s, GF_OK);
 	if (s->buffer) gf_free(s->buffer);
+	if (s->range_buf) gf_free(s->range_buf);
 	if (s->path) gf_free(s->path);
 	if (s->mime) gf_free(s->mime);
 	if (s->opid) gf_filter_pid_remove(s->opid);
@@ -3122,6 +3337,12 @@ static void httpout_finalize(GF_Filter *filter)
 		gf_free(in);
 	}
 	gf_list_del(ctx->inputs);
+	while (gf_list_count(ctx->seg_maps)) {
+		HTTPSegmentMap *smap = gf_list_pop_back(ctx->seg_maps);
+		httpout_del_segment_map(smap);
+	}
+	gf_list_del(ctx->seg_maps);
+	if (ctx->chunk_buf) gf_free(ctx->chunk_buf);
 	if (ctx->server_sock) gf_sk_del(ctx->server_sock);
 	if (ctx->sg) gf_sk_group_del(ctx->sg);
 	if (ctx->ip) gf_free(ctx->ip);
@@ -3259,6 +3480,7 @@ static void log_request_done(GF_HTTPOutSession *sess)
 static void httpout_process_session(GF_Filter *filter, GF_HTTPOutCtx *ctx, GF_HTTPOutSession *sess)
 {
 	u32 read;
+	u8 *read_buf;
 	u64 to_read=0;
 	GF_Err e = GF_OK;
 	Bool file_in_progress, last_range;
@@ -3534,6 +3756,10 @@ static void httpout_process_session(GF_Filter *filter, GF_HTTPOutCtx *ctx, GF_HT
 		sess->file_size = gf_fsize(sess->resource);
 		gf_fseek(sess->resource, sess->file_pos, SEEK_SET);
 	}
+	else if (sess->resource_seek_pending) {
+		gf_fseek(sess->resource, sess->file_pos, SEEK_SET);
+	}
+	sess->resource_seek_pending = GF_FALSE;
 
 resend:
 	last_range=GF_FALSE;
@@ -3590,15 +3816,23 @@ resend:
 		//rescedule asap while we send
 		ctx->next_wake_us = 1;
 
-		if (to_read > (u64) sess->ctx->block_size)
-			to_read = (u64) sess->ctx->block_size;
+		if (sess->range_read_size && !sess->comp_data && sess->resource && !sess->use_chunk_transfer && (to_read <= sess->range_read_size)) {
+			read_buf = sess->range_buf;
+		} else {
+			read_buf = sess->buffer;
+			//read after chunk header space so that the chunk is sent in a single call
+			if (!sess->is_h2 && sess->use_chunk_transfer && !sess->comp_data && sess->resource)
+				read_buf += HTTPOUT_CHUNK_HDR_MAX;
+			if (to_read > (u64) sess->ctx->block_size)
+				to_read = (u64) sess->ctx->block_size;
+		}
 
 		if (sess->comp_data) {
 			memcpy(sess->buffer, sess->comp_data+sess->file_pos, to_read);
 			read = (u32) to_read;
 		}
 		else if (sess->resource) {
-			read = (u32) gf_fread(sess->buffer, (u32) to_read, sess->resource);
+			read = (u32) gf_fread(read_buf, (u32) to_read, sess->resource);
 			//may happen when file writing is in progress
 			if (!read) {
 				sess->last_active_time = gf_sys_clock_high_res();
@@ -3609,16 +3843,16 @@ resend:
 		}
 		//transfer of file being uploaded, use chunk transfer
 		if (!sess->is_h2 && sess->use_chunk_transfer) {
-			char szHdr[100];
-			u32 len;
-			sprintf(szHdr, "%X\r\n", read);
-			len = (u32) strlen(szHdr);
-
-			e = gf_dm_sess_send(sess->http_sess, szHdr, len);
-			e |= gf_dm_sess_send(sess->http_sess, sess->buffer, read);
-			e |= gf_dm_sess_send(sess->http_sess, "\r\n", 2);
+			u32 chunk_size;
+			u8 *chunk;
+			if (read_buf == sess->buffer) {
+				memmove(sess->buffer + HTTPOUT_CHUNK_HDR_MAX, sess->buffer, read);
+				read_buf += HTTPOUT_CHUNK_HDR_MAX;
+			}
+			chunk = httpout_frame_chunk(read_buf, read, &chunk_size);
+			e = gf_dm_sess_send(sess->http_sess, chunk, chunk_size);
 		} else {
-			e = gf_dm_sess_send(sess->http_sess, sess->buffer, read);
+			e = gf_dm_sess_send(sess->http_sess, read_buf, read);
 		}
 		sess->last_active_time = gf_sys_clock_high_res();
 
@@ -3657,6 +3891,12 @@ resend:
 session_done:
 
 	sess->file_pos = sess->file_size;
+	//release range buffer once the request is done, keep-alive sessions would otherwise hold it until closed
+	if (sess->range_buf) {
+		gf_free(sess->range_buf);
+		sess->range_buf = NULL;
+	}
+	sess->range_buf_size = sess->range_read_size = 0;
 	sess->last_active_time = gf_sys_clock_high_res();
 
 	//an error ocured uploading the resource, we cannot notify that error so we force a close...
@@ -4095,6 +4335,41 @@ static Bool httpout_open_input_llhls(GF_HTTPOutCtx *ctx, GF_HTTPOutInput *in, ch
 	return GF_TRUE;
 }
 
+static u8 *httpout_get_framed_chunk(GF_HTTPOutCtx *ctx, const u8 *pck_data, u32 pck_size, u32 *chunk_size)
+{
+	if (ctx->chunk_buf_alloc < pck_size + HTTPOUT_CHUNK_OVERHEAD) {
+		ctx->chunk_buf_alloc = pck_size + HTTPOUT_CHUNK_OVERHEAD;
+		ctx->chunk_buf = gf_realloc(ctx->chunk_buf, ctx->chunk_buf_alloc);
+		if (!ctx->chunk_buf) {
+			ctx->chunk_buf_alloc = 0;
+			return NULL;
+		}
+	}
+	memcpy(ctx->chunk_buf + HTTPOUT_CHUNK_HDR_MAX, pck_data, pck_size);
+	return httpout_frame_chunk(ctx->chunk_buf + HTTPOUT_CHUNK_HDR_MAX, pck_size, chunk_size);
+}
+
+//send packet data as a chunk: the first destination gets header, payload and trailer without copying the payload,
+//the chunk is framed once in the shared buffer only when more destinations follow
+static GF_Err httpout_send_pck_chunk(GF_HTTPOutCtx *ctx, GF_DownloadSession *sess, const u8 *pck_data, u32 pck_size, u8 **chunk, u32 *chunk_size, u32 *nb_dst)
+{
+	(*nb_dst)++;
+	if (*nb_dst == 1) {
+		GF_Err e;
+		char szHdr[HTTPOUT_CHUNK_HDR_MAX+1];
+		sprintf(szHdr, "%X\r\n", pck_size);
+		e = gf_dm_sess_send(sess, szHdr, (u32) strlen(szHdr));
+		e |= gf_dm_sess_send(sess, (u8 *) pck_data, pck_size);
+		e |= gf_dm_sess_send(sess, "\r\n", 2);
+		return e;
+	}
+	if (!*chunk) {
+		*chunk = httpout_get_framed_chunk(ctx, pck_data, pck_size, chunk_size);
+		if (!*chunk) return GF_OUT_OF_MEM;
+	}
+	return gf_dm_sess_send(sess, *chunk, *chunk_size);
+}
+
 u32 httpout_write_input(GF_HTTPOutCtx *ctx, GF_HTTPOutInput *in, const u8 *pck_data, u32 pck_size, Bool file_start)
 {
 	u32 out=0;
@@ -4104,17 +4379,13 @@ u32 httpout_write_input(GF_HTTPOutCtx *ctx, GF_HTTPOutInput *in, const u8 *pck_d
 	GF_LOG(GF_LOG_DEBUG, GF_LOG_MMIO, ("[HTTPOut] Writing %d bytes to output file %s\n", pck_size, in->local_path ? in->local_path : in->path));
 
 	if (in->upload) {
-		char szChunkHdr[100];
-		u32 chunk_hdr_len=0;
+		u8 *chunk = NULL;
+		u32 chunk_size = 0, nb_dst = 0;
 		GF_Err e;
 		u32 s_idx, max_out = 1;
 		u32 nb_retry = 0;
 		out = pck_size;
 
-		if (!in->is_h2) {
-			sprintf(szChunkHdr, "%X\r\n", pck_size);
-			chunk_hdr_len = (u32) strlen(szChunkHdr);
-		}
 		if (in->llhls_upload && in->llhls_is_open)
 			max_out = 2;
 
@@ -4122,9 +4393,7 @@ u32 httpout_write_input(GF_HTTPOutCtx *ctx, GF_HTTPOutInput *in, const u8 *pck_d
 			GF_DownloadSession *up_sess = s_idx ? in->llhls_upload : in->upload;
 retry:
 			if (!in->is_h2) {
-				e = gf_dm_sess_send(up_sess, szChunkHdr, chunk_hdr_len);
-				e |= gf_dm_sess_send(up_sess, (u8 *) pck_data, pck_size);
-				e |= gf_dm_sess_send(up_sess, "\r\n", 2);
+				e = httpout_send_pck_chunk(ctx, up_sess, pck_data, pck_size, &chunk, &chunk_size, &nb_dst);
 			} else {
 				e = gf_dm_sess_send(up_sess, (u8 *) pck_data, pck_size);
 			}
@@ -4181,8 +4450,8 @@ retry:
 		}
 
 	} else {
-		char szChunkHdr[100];
-		u32 chunk_hdr_len=0;
+		u8 *chunk = NULL;
+		u32 chunk_size = 0, nb_dst = 0;
 		u32 i, count = gf_list_count(ctx->active_sessions);
 
 		if (in->resource) {
@@ -4221,22 +4490,42 @@ retry:
 			}
 			sess->send_init_data = GF_FALSE;
 
-			/*source is read from disk but a different file handle is used, force refresh by using fseek (so use fsize and seek back to current pos)*/
+			/*source is read from disk but a different file handle is used, force refresh by using fseek before next read*/
 			if (sess->file_in_progress) {
-				sess->file_size = gf_fsize(sess->resource);
-				gf_fseek(sess->resource, sess->file_pos, SEEK_SET);
+				if (sess->in_source_is_ll_hls_chunk || !sess->resource || in->patch_blocks) {
+					sess->file_size = gf_fsize(sess->resource);
+					gf_fseek(sess->resource, sess->file_pos, SEEK_SET);
+					continue;
+				}
+				//reader is up to date with the writer and has nothing pending: send new bytes right away from the packet
+				//rather than waiting for next process call and reading them back from disk
+				if ((out==pck_size) && !sess->nb_ranges && sess->headers_done
+					&& (sess->file_pos == in->nb_write) && !gf_dm_sess_async_pending(sess->http_sess)
+				) {
+					GF_Err e;
+					if (!sess->is_h2) {
+						e = httpout_send_pck_chunk(ctx, sess->http_sess, pck_data, pck_size, &chunk, &chunk_size, &nb_dst);
+					} else {
+						e = gf_dm_sess_send(sess->http_sess, (u8*) pck_data, pck_size);
+					}
+					if ((e==GF_IP_CONNECTION_CLOSED) || (e==GF_URL_REMOVED)) {
+						httpout_close_session(sess, e);
+						continue;
+					}
+					if (!e) {
+						sess->file_pos += pck_size;
+						sess->nb_bytes += pck_size;
+						sess->last_active_time = gf_sys_clock_high_res();
+					}
+				}
+				sess->file_size = in->nb_write + out;
+				sess->resource_seek_pending = GF_TRUE;
 			}
 			/*source is not read from disk, write data*/
 			else {
 				GF_Err e;
 				if (!sess->is_h2) {
-					if (!chunk_hdr_len) {
-						sprintf(szChunkHdr, "%X\r\n", pck_size);
-						chunk_hdr_len = (u32) strlen(szChunkHdr);
-					}
-					e = gf_dm_sess_send(sess->http_sess, szChunkHdr, chunk_hdr_len);
-					e |= gf_dm_sess_send(sess->http_sess, (u8*) pck_data, pck_size);
-					e |= gf_dm_sess_send(sess->http_sess, "\r\n", 2);
+					e = httpout_send_pck_chunk(ctx, sess->http_sess, pck_data, pck_size, &chunk, &chunk_size, &nb_dst);
 				} else {
 					e = gf_dm_sess_send(sess->http_sess, (u8*) pck_data, pck_size);
 				}
@@ -4988,6 +5277,7 @@ static const GF_FilterArgs HTTPOutArgs[] =
 	{ OFFS(cert), "certificate file in PEM format to use for TLS mode", GF_PROP_STRING, NULL, NULL, 0},
 	{ OFFS(pkey), "private key file in PEM format to use for TLS mode", GF_PROP_STRING, NULL, NULL, 0},
 	{ OFFS(block_size), "block size used to read and write TCP socket", GF_PROP_UINT, "10000", NULL, GF_FS_ARG_HINT_ADVANCED},
+	{ OFFS(srange), "maximum size of byte ranges matching ISOBMFF subsegment boundaries to read and send at once (at most 8 MB), 0 disables it", GF_PROP_UINT, "2000000", NULL, GF_FS_ARG_HINT_EXPERT},
 	{ OFFS(user_agent), "user agent string, by default solved from GPAC preferences", GF_PROP_STRING, "$GUA", NULL, 0},
 	{ OFFS(close), "close HTTP connection after each request", GF_PROP_BOOL, "false", NULL, GF_FS_ARG_HINT_EXPERT},
 	{ OFFS(maxc), "maximum number of connections, 0 is unlimited", GF_PROP_UINT, "100", NULL, GF_FS_ARG_HINT_EXPERT},
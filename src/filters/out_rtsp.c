@@ -168,6 +168,13 @@ typedef struct __rtspout_session
 
 	u32 last_active_time;
 	char *setup_ctrl;
+
+	/*session owning the source filters and RTP packetizers used by this session, NULL if none*/
+	struct __rtspout_session *shared_src;
+	/*number of sessions using our source filters and RTP packetizers*/
+	u32 nb_shared;
+	/*RTP channels of the session are muted, packets are only sent to the sessions sharing our source*/
+	Bool muted;
 } GF_RTSPOutSession;
 
 static GF_Err rtspout_process_setup(GF_RTSPOutCtx *ctx, GF_RTSPOutSession *sess, char *ctrl);
@@ -267,15 +274,85 @@ static void rtspout_del_stream(GF_RTPOutStream *st)
 }
 
 
+static void rtspout_mute_session(GF_RTSPOutSession *sess, Bool mute)
+{
+	u32 i, count = gf_list_count(sess->streams);
+	if (sess->muted == mute) return;
+	sess->muted = mute;
+	for (i=0; i<count; i++) {
+		GF_RTPOutStream *stream = gf_list_get(sess->streams, i);
+		gf_rtp_streamer_mute(stream->rtp, mute);
+	}
+}
+
+static void rtspout_detach_shared(GF_RTSPOutSession *sess)
+{
+	u32 i, count = gf_list_count(sess->streams);
+	for (i=0; i<count; i++) {
+		GF_RTPOutStream *stream = gf_list_get(sess->streams, i);
+		gf_rtp_streamer_remove_mirror(stream->rtp);
+	}
+}
+
+static GF_RTPOutStream *rtspout_get_shared_stream(GF_RTSPOutSession *src, GF_RTPOutStream *stream)
+{
+	u32 i, count = gf_list_count(src->streams);
+	for (i=0; i<count; i++) {
+		GF_RTPOutStream *src_stream = gf_list_get(src->streams, i);
+		if (src_stream->pid == stream->pid) return src_stream;
+	}
+	return NULL;
+}
+
+//removes streams of sessions sharing the given source for the given pid, or all streams and sharing if pid is NULL
+static void rtspout_unshare_session(GF_RTSPOutSession *src, GF_FilterPid *pid)
+{
+	u32 i, count = gf_list_count(src->ctx->sessions);
+	for (i=0; i<count; i++) {
+		GF_RTSPOutSession *a_sess = gf_list_get(src->ctx->sessions, i);
+		if (a_sess->shared_src != src) continue;
+
+		u32 j = gf_list_count(a_sess->streams);
+		while (j) {
+			GF_RTPOutStream *stream = gf_list_get(a_sess->streams, j-1);
+			j--;
+			if (pid && (stream->pid != pid)) continue;
+			gf_list_rem(a_sess->streams, j);
+			//pid is owned by the source session
+			stream->pid = NULL;
+			rtspout_del_stream(stream);
+		}
+		if (pid) continue;
+		a_sess->shared_src = NULL;
+		a_sess->play_state = 0;
+		src->nb_shared--;
+	}
+}
+
+static void rtspout_send_event(GF_RTSPOutSession *sess, Bool send_stop, Bool send_play, Double start_range);
+
 static void rtspout_del_session(GF_Filter *filter, GF_RTSPOutSession *sess)
 {
+	//sessions sharing our source are detached and will time out
+	if (sess->nb_shared)
+		rtspout_unshare_session(sess, NULL);
+
 	//server mode, cleanup
 	while (gf_list_count(sess->streams)) {
 		GF_RTPOutStream *stream = gf_list_pop_back(sess->streams);
+		if (sess->shared_src) stream->pid = NULL;
 		rtspout_del_stream(stream);
 	}
 	gf_list_del(sess->streams);
 
+	if (sess->shared_src) {
+		GF_RTSPOutSession *src = sess->shared_src;
+		src->nb_shared--;
+		//source was only kept alive for shared sessions, stop it
+		if (!src->nb_shared && !src->play_state)
+			rtspout_send_event(src, GF_TRUE, GF_FALSE, 0);
+	}
+
 	if (sess->service_name)
 		gf_free(sess->service_name);
 	if (sess->sessionID)
@@ -348,6 +425,8 @@ static GF_Err rtspout_configure_pid(GF_Filter *filter, GF_FilterPid *pid, Bool i
 		GF_RTPOutStream *t = gf_filter_pid_get_udta(pid);
 		if (t) {
 			if (sess->active_stream==t) sess->active_stream = NULL;
+			if (sess->nb_shared)
+				rtspout_unshare_session(sess, pid);
 			gf_list_del_item(sess->streams, t);
 			rtspout_del_stream(t);
 		}
@@ -649,6 +728,57 @@ static void rtspout_finalize(GF_Filter *filter)
 }
 
 
+static void rtspout_send_play_response(GF_RTSPOutCtx *ctx, GF_RTSPOutSession *sess)
+{
+	u32 i, count = gf_list_count(sess->streams);
+
+	gf_rtsp_response_reset(sess->response);
+	sess->response->ResponseCode = NC_RTSP_OK;
+	for (i=0; i<count; i++) {
+		GF_RTPInfo *rtpi;
+		GF_RTPOutStream *src_stream;
+		GF_RTPOutStream *stream = gf_list_get(sess->streams, i);
+		if (!stream->selected) continue;
+		if (!stream->send_rtpinfo) continue;
+		stream->send_rtpinfo = GF_FALSE;
+
+		//shared session, timestamps are the ones of the source stream
+		src_stream = sess->shared_src ? rtspout_get_shared_stream(sess->shared_src, stream) : stream;
+		if (!src_stream) continue;
+
+		GF_SAFEALLOC(rtpi, GF_RTPInfo);
+		if (rtpi) {
+			u32 timescale;
+			rtpi->url = gf_malloc(sizeof(char) * (strlen(sess->service_name)+50));
+			sprintf(rtpi->url, "%s/%s=%d", sess->service_name, sess->ctrl_name, stream->ctrl_id);
+			rtpi->seq = gf_rtp_streamer_get_next_rtp_sn(stream->rtp);
+			rtpi->rtp_time = (u32) (src_stream->current_cts + src_stream->ts_offset + src_stream->rtp_ts_offset);
+
+			timescale = gf_rtp_streamer_get_timescale(stream->rtp);
+			if (timescale)
+				rtpi->rtp_time = (u32) gf_timestamp_rescale(rtpi->rtp_time, stream->timescale, timescale);
+			//offset of shared session is in RTP timescale
+			if (sess->shared_src)
+				rtpi->rtp_time += stream->rtp_ts_offset;
+
+			gf_list_add(sess->response->RTP_Infos, rtpi);
+
+#ifdef GPAC_ENABLE_COVERAGE
+			if (gf_sys_is_cov_mode()) {
+				gf_rtp_streamer_get_ssrc(stream->rtp);
+			}
+#endif
+		}
+	}
+	GF_SAFEALLOC(sess->response->Range, GF_RTSPRange);
+	if (sess->response->Range)
+		sess->response->Range->start = sess->start_range;
+
+	sess->response->CSeq = sess->last_cseq;
+	rtspout_send_response(ctx, sess);
+	sess->request_pending = GF_FALSE;
+}
+
 static Bool rtspout_init_clock(GF_RTSPOutCtx *ctx, GF_RTSPOutSession *sess)
 {
 	u64 min_dts = GF_FILTER_NO_TS;
@@ -700,44 +830,7 @@ static Bool rtspout_init_clock(GF_RTSPOutCtx *ctx, GF_RTSPOutSession *sess)
 		}
 	}
 
-
-	gf_rtsp_response_reset(sess->response);
-	sess->response->ResponseCode = NC_RTSP_OK;
-	for (i=0; i<count; i++) {
-		GF_RTPInfo *rtpi;
-		GF_RTPOutStream *stream = gf_list_get(sess->streams, i);
-		if (!stream->selected) continue;
-		if (!stream->send_rtpinfo) continue;
-		stream->send_rtpinfo = GF_FALSE;
-
-		GF_SAFEALLOC(rtpi, GF_RTPInfo);
-		if (rtpi) {
-			u32 timescale;
-			rtpi->url = gf_malloc(sizeof(char) * (strlen(sess->service_name)+50));
-			sprintf(rtpi->url, "%s/%s=%d", sess->service_name, sess->ctrl_name, stream->ctrl_id);
-			rtpi->seq = gf_rtp_streamer_get_next_rtp_sn(stream->rtp);
-			rtpi->rtp_time = (u32) (stream->current_cts + stream->ts_offset + stream->rtp_ts_offset);
-
-			timescale = gf_rtp_streamer_get_timescale(stream->rtp);
-			if (timescale)
-				rtpi->rtp_time = (u32) gf_timestamp_rescale(rtpi->rtp_time, stream->timescale, timescale);
-
-			gf_list_add(sess->response->RTP_Infos, rtpi);
-
-#ifdef GPAC_ENABLE_COVERAGE
-			if (gf_sys_is_cov_mode()) {
-				gf_rtp_streamer_get_ssrc(stream->rtp);
-			}
-#endif
-		}
-	}
-	GF_SAFEALLOC(sess->response->Range, GF_RTSPRange);
-	if (sess->response->Range)
-		sess->response->Range->start = sess->start_range;
-
-	sess->response->CSeq = sess->last_cseq;
-	rtspout_send_response(ctx, sess);
-	sess->request_pending = GF_FALSE;
+	rtspout_send_play_response(ctx, sess);
 	return GF_TRUE;
 }
 
@@ -746,6 +839,14 @@ static void rtspout_send_event(GF_RTSPOutSession *sess, Bool send_stop, Bool sen
 	GF_FilterEvent fevt;
 	u32 i, count = gf_list_count(sess->streams);
 
+	//pids are controlled by the source session
+	if (sess->shared_src) return;
+	//source still used by shared sessions, only stop sending to our client
+	if (send_stop && sess->nb_shared) {
+		rtspout_mute_session(sess, GF_TRUE);
+		return;
+	}
+
 	memset(&fevt, 0, sizeof(GF_FilterEvent));
 
 	for (i=0; i<count; i++) {
@@ -790,13 +891,16 @@ static GF_Err rtspout_process_rtp(GF_Filter *filter, GF_RTSPOutCtx *ctx, GF_RTSP
 		if (!rtspout_init_clock(ctx, sess)) return GF_OK;
 	}
 
-	if (sess->rtsp && sess->interleave) {
+	if (sess->rtsp && sess->interleave && !sess->muted) {
 		e = gf_rtsp_check_connection(sess->rtsp);
 		if (e==GF_IP_NETWORK_EMPTY) {
 			ctx->next_wake_us = 100;
 			return GF_OK;
 		} else if (e) {
-			return e;
+			if (!sess->nb_shared)
+				return e;
+			//keep feeding shared sessions
+			rtspout_mute_session(sess, GF_TRUE);
 		}
 	}
 
@@ -804,6 +908,10 @@ static GF_Err rtspout_process_rtp(GF_Filter *filter, GF_RTSPOutCtx *ctx, GF_RTSP
 
 	if (e) {
 		if ((e==GF_IP_CONNECTION_CLOSED) || (e==GF_IP_CONNECTION_FAILURE)) {
+			if (sess->nb_shared) {
+				rtspout_mute_session(sess, GF_TRUE);
+				return GF_OK;
+			}
 			sess->play_state = 0;
 			rtspout_send_event(sess, GF_TRUE, GF_FALSE, 0);
 
@@ -817,6 +925,57 @@ static GF_Err rtspout_process_rtp(GF_Filter *filter, GF_RTSPOutCtx *ctx, GF_RTSP
 	return GF_OK;
 }
 
+static void rtspout_shared_rtcp(void *cbk, u32 ssrc, u32 rtt_ms, u64 jitter_rtp_ts, u32 loss_rate)
+{
+	GF_RTSPOutSession *sess = (GF_RTSPOutSession *)cbk;
+	if (!ssrc) sess->last_active_time = gf_sys_clock();
+}
+
+static GF_Err rtspout_process_shared(GF_RTSPOutCtx *ctx, GF_RTSPOutSession *sess)
+{
+	u32 i, count = gf_list_count(sess->streams);
+	GF_RTSPOutSession *src = sess->shared_src;
+
+	//attach our RTP streamers to the source ones once the source is running
+	if (!sess->sys_clock_at_init) {
+		if (!src->sys_clock_at_init) return GF_OK;
+
+		gf_rand_init(GF_FALSE);
+		for (i=0; i<count; i++) {
+			GF_RTPOutStream *stream = gf_list_get(sess->streams, i);
+			GF_RTPOutStream *src_stream = rtspout_get_shared_stream(src, stream);
+			if (!stream->selected || !src_stream) continue;
+
+			//offset in RTP timescale applied to source timestamps
+			stream->rtp_ts_offset = 0;
+			if (ctx->tso<0) {
+				stream->rtp_ts_offset = gf_rand();
+				while (stream->rtp_ts_offset>0xFFFFFFF)
+					stream->rtp_ts_offset/=2;
+			}
+			gf_rtp_streamer_add_mirror(src_stream->rtp, stream->rtp, stream->rtp_ts_offset);
+		}
+		sess->sys_clock_at_init = src->sys_clock_at_init;
+		sess->microsec_ts_init = src->microsec_ts_init;
+		GF_LOG(GF_LOG_INFO, GF_LOG_RTP, ("[RTSPOut] Session %s: sharing source of session %s\n", sess->service_name, src->service_name));
+		rtspout_send_play_response(ctx, sess);
+	}
+
+	//interleaved session is gone, stop sending and wait for timeout
+	if (sess->interleave && !sess->rtsp) {
+		rtspout_detach_shared(sess);
+		sess->play_state = 0;
+		return GF_OK;
+	}
+
+	for (i=0; i<count; i++) {
+		GF_RTPOutStream *stream = gf_list_get(sess->streams, i);
+		if (stream->selected)
+			gf_rtp_streamer_read_rtcp(stream->rtp, rtspout_shared_rtcp, sess);
+	}
+	return GF_OK;
+}
+
 static GF_Err rtspout_interleave_packet(void *cbk1, void *cbk2, Bool is_rtcp, u8 *pck, u32 pck_size)
 {
 	GF_RTSPOutSession *sess = (GF_RTSPOutSession *)cbk1;
@@ -851,14 +1010,100 @@ Bool rtspout_on_filter_setup_error(GF_Filter *f, void *on_setup_error_udta, GF_E
 	return GF_TRUE;
 }
 
-static GF_Err rtspout_load_media_service(GF_Filter *filter, GF_RTSPOutCtx *ctx, GF_RTSPOutSession *sess, char *src_url)
+//locates a running session on the given live resource
+static GF_RTSPOutSession *rtspout_locate_shared(GF_RTSPOutCtx *ctx, GF_RTSPOutSession *sess, const char *src_url)
+{
+	u32 i, count = gf_list_count(ctx->sessions);
+	for (i=0; i<count; i++) {
+		u32 j, nb_streams, nb_sel=0;
+		const char *url;
+		char szDump[GF_PROP_DUMP_ARG_SIZE];
+		GF_RTSPOutSession *a_sess = gf_list_get(ctx->sessions, i);
+		if ((a_sess==sess) || a_sess->shared_src || a_sess->single_session || a_sess->multicast_ip) continue;
+		if ((a_sess->sdp_state != SDP_LOADED) || !a_sess->sys_clock_at_init) continue;
+		if ((a_sess->play_state != 1) && !a_sess->nb_shared) continue;
+		if (gf_list_count(a_sess->filter_srcs) != 1) continue;
+
+		url = gf_filter_get_arg_str(gf_list_get(a_sess->filter_srcs, 0), "src", szDump);
+		if (!url || strcmp(url, src_url)) continue;
+
+		//only share live sources, seekable ones are played independently by each session
+		nb_streams = gf_list_count(a_sess->streams);
+		for (j=0; j<nb_streams; j++) {
+			GF_RTPOutStream *stream = gf_list_get(a_sess->streams, j);
+			const GF_PropertyValue *p = gf_filter_pid_get_property(stream->pid, GF_PROP_PID_PLAYBACK_MODE);
+			if (p && (p->value.uint != GF_PLAYBACK_MODE_NONE)) break;
+			if (stream->selected) nb_sel++;
+		}
+		if ((j==nb_streams) && nb_sel)
+			return a_sess;
+	}
+	return NULL;
+}
+
+//creates our streams from the streams being sent by the source session
+static GF_Err rtspout_share_session(GF_Filter *filter, GF_RTSPOutCtx *ctx, GF_RTSPOutSession *sess, GF_RTSPOutSession *src)
+{
+	GF_Err e = GF_OK;
+	u32 i, count = gf_list_count(src->streams);
+
+	for (i=0; i<count; i++) {
+		GF_RTPOutStream *stream;
+		const GF_PropertyValue *p;
+		GF_RTPOutStream *src_stream = gf_list_get(src->streams, i);
+		if (!src_stream->selected || !src_stream->rtp) continue;
+
+		GF_SAFEALLOC(stream, GF_RTPOutStream);
+		if (!stream) {
+			e = GF_OUT_OF_MEM;
+			break;
+		}
+		gf_list_add(sess->streams, stream);
+		stream->pid = src_stream->pid;
+		p = gf_filter_pid_get_property(stream->pid, GF_PROP_PID_STREAM_TYPE);
+		stream->streamtype = p ? p->value.uint : 0;
+		stream->min_dts = GF_FILTER_NO_TS;
+		stream->on_rtcp = rtspout_on_rtcp;
+		stream->on_rtcp_udta = sess;
+		stream->ctrl_id = src_stream->ctrl_id;
+		stream->ctrl_name = sess->ctrl_name;
+
+		e = rtpout_init_streamer(stream, ctx->ifce ? ctx->ifce : "127.0.0.1", ctx->xps, ctx->mpeg4, ctx->latm, gf_rtp_streamer_get_payload_type(src_stream->rtp), ctx->mtu, ctx->ttl, ctx->ifce, GF_TRUE, &sess->base_pid_id, 0, gf_filter_get_netcap_id(filter));
+		if (e) break;
+	}
+	if (e) {
+		while (gf_list_count(sess->streams)) {
+			GF_RTPOutStream *stream = gf_list_pop_back(sess->streams);
+			stream->pid = NULL;
+			rtspout_del_stream(stream);
+		}
+		return e;
+	}
+	sess->shared_src = src;
+	src->nb_shared++;
+	sess->next_stream_id = src->next_stream_id;
+	sess->sdp_state = SDP_LOADED;
+	GF_LOG(GF_LOG_INFO, GF_LOG_RTP, ("[RTSPOut] Session from %s uses running session %s\n", sess->peer_address, src->service_name));
+	return GF_OK;
+}
+
+static GF_Err rtspout_load_media_service(GF_Filter *filter, GF_RTSPOutCtx *ctx, GF_RTSPOutSession *sess, char *src_url, Bool can_share)
 {
 	GF_Err e;
 	Bool found = GF_FALSE;
 	u32 i, count = gf_list_count(sess->filter_srcs);
+
+	if (sess->shared_src) return GF_OK;
+	//check if this resource is a live source already sent by another session
+	if (can_share && !count) {
+		GF_RTSPOutSession *a_sess = rtspout_locate_shared(ctx, sess, src_url);
+		if (a_sess)
+			return rtspout_share_session(filter, ctx, sess, a_sess);
+	}
 	for (i=0; i<count; i++) {
 		GF_Filter *src = gf_list_get(sess->filter_srcs, i);
-		const char *url = gf_filter_get_arg_str(src, "src", NULL);
+		char szDump[GF_PROP_DUMP_ARG_SIZE];
+		const char *url = gf_filter_get_arg_str(src, "src", szDump);
 		if (url && !strcmp(src_url, url)) {
 			found = GF_TRUE;
 			break;
@@ -1494,11 +1739,13 @@ static GF_Err rtspout_process_session_signaling(GF_Filter *filter, GF_RTSPOutCtx
 					if (rsp_code != NC_RTSP_OK)
 						break;
 				}
+				//sources can only be shared for single-source services
+				Bool can_share = (gf_list_count(paths)==1) ? GF_TRUE : GF_FALSE;
 				while (gf_list_count(paths)) {
 					char *src_url = gf_list_pop_front(paths);
 					if (rsp_code == NC_RTSP_OK) {
 						//load media service
-						e = rtspout_load_media_service(filter, ctx, sess, src_url);
+						e = rtspout_load_media_service(filter, ctx, sess, src_url, can_share);
 						if (e) {
 							rsp_code = NC_RTSP_Service_Unavailable;
 						}
@@ -1513,7 +1760,7 @@ static GF_Err rtspout_process_session_signaling(GF_Filter *filter, GF_RTSPOutCtx
 			if (src_url) {
 				rsp_code = NC_RTSP_OK;
 				//load media service
-				e = rtspout_load_media_service(filter, ctx, sess, src_url);
+				e = rtspout_load_media_service(filter, ctx, sess, src_url, GF_TRUE);
 				gf_free(src_url);
 				if (e) {
 					rsp_code = NC_RTSP_Service_Unavailable;
@@ -1618,7 +1865,30 @@ static GF_Err rtspout_process_session_signaling(GF_Filter *filter, GF_RTSPOutCtx
 			if (ctx->loop && !sess->loop_disabled && (sess->single_session || sess->multicast_ip))
 				sess->loop = GF_TRUE;
 
-			if ((sess->play_state==2) && !sess->command->Range) {
+			rtspout_mute_session(sess, GF_FALSE);
+
+			if (sess->shared_src) {
+				u32 i, count = gf_list_count(sess->streams);
+				//RTP streamers are attached to the source once running
+				for (i=0; i<count; i++) {
+					GF_RTPOutStream *stream = gf_list_get(sess->streams, i);
+					if (stream->selected) stream->send_rtpinfo = GF_TRUE;
+				}
+				sess->play_state = 1;
+				sess->sys_clock_at_init = 0;
+				sess->start_range = 0;
+				sess->last_cseq = sess->command->CSeq;
+				sess->request_pending = GF_TRUE;
+			} else if (sess->nb_shared && (sess->play_state!=1)) {
+				//source kept running for shared sessions, resume sending
+				sess->pause_sys_clock = 0;
+				sess->play_state = 1;
+
+				gf_rtsp_response_reset(sess->response);
+				sess->response->ResponseCode = NC_RTSP_OK;
+				sess->response->CSeq = sess->command->CSeq;
+				rtspout_send_response(ctx, sess);
+			} else if ((sess->play_state==2) && !sess->command->Range) {
 				u64 elapsed_us = gf_sys_clock_high_res() - sess->pause_sys_clock;
 				sess->pause_sys_clock = 0;
 				sess->play_state = 1;
@@ -1646,6 +1916,13 @@ static GF_Err rtspout_process_session_signaling(GF_Filter *filter, GF_RTSPOutCtx
 			sess->play_state = 2;
 			sess->pause_sys_clock = gf_sys_clock_high_res();
 		}
+		if (sess->shared_src) {
+			rtspout_detach_shared(sess);
+		}
+		//source still used by shared sessions, only stop sending to our client
+		else if (sess->nb_shared) {
+			rtspout_mute_session(sess, GF_TRUE);
+		}
 		gf_rtsp_response_reset(sess->response);
 		sess->response->ResponseCode = NC_RTSP_OK;
 		sess->response->CSeq = sess->command->CSeq;
@@ -1656,6 +1933,8 @@ static GF_Err rtspout_process_session_signaling(GF_Filter *filter, GF_RTSPOutCtx
 	if (!strcmp(sess->command->method, GF_RTSP_TEARDOWN)) {
 		sess->play_state = 0;
 		rtspout_send_event(sess, GF_TRUE, GF_FALSE, 0);
+		if (sess->shared_src)
+			rtspout_detach_shared(sess);
 
 		gf_rtsp_response_reset(sess->response);
 		sess->response->ResponseCode = NC_RTSP_OK;
@@ -1750,7 +2029,10 @@ static GF_Err rtspout_process(GF_Filter *filter)
 		if (sess_err) e |= sess_err;
 		if (!sess) break;
 
-		if (sess->play_state==1) {
+		if (sess->shared_src) {
+			if (sess->play_state==1)
+				rtspout_process_shared(ctx, sess);
+		} else if ((sess->play_state==1) || sess->nb_shared) {
 			sess_err = rtspout_process_rtp(filter, ctx, sess);
 			if (sess_err) e |= sess_err;
 		}
@@ -1768,6 +2050,11 @@ static GF_Err rtspout_process(GF_Filter *filter)
 		}
 
 		if (sess->last_active_time && ctx->ms_timeout && (now > sess->last_active_time + ctx->ms_timeout)) {
+			//source still used by shared sessions, only stop sending to our client
+			if (sess->nb_shared) {
+				rtspout_mute_session(sess, GF_TRUE);
+				continue;
+			}
 			GF_LOG(GF_LOG_INFO, GF_LOG_RTP, ("[RTSP] Timeout on session %s after %d ms, aborting\n", sess->service_name, now-sess->last_active_time));
 			rtspout_del_session(filter, sess);
 			i--;
@@ -1903,6 +2190,11 @@ GF_FilterRegister RTSPOutRegister = {
 		"\n"
 		"Note: If the [-dynurl]() is set, it is enabled for all users, without authentication.\n"
 		"\n"
+		"When a client requests a single resource (from a mount point or a dynamic URL) which is already being played by another session and all streams of this resource are live (not seekable), "
+		"the new session shares the source and RTP packetizers of the running session instead of loading the resource again. "
+		"Each packet is only built once and sent to each client with the client RTP sequence number, SSRC and timestamp offset.\n"
+		"Seekable resources are always loaded for each session.\n"
+		"\n"
 		"# Multicasting\n"
 		"In both modes, clients can setup multicast if the [-mcast]() option is `on` or `mirror`.\n"
 		"When [-mcast]() is set to `mirror` mode, any DESCRIBE command on a resource already delivered through a multicast session will use that multicast.\n"
@@ -31,21 +31,44 @@
 #include <gpac/constants.h>
 #include <gpac/network.h>
 
+//data block shared by all clients, either referencing an input packet or holding a copy of its data
+typedef struct
+{
+	GF_FilterPacket *pck;
+	const u8 *data;
+	u32 size;
+	u8 *buffer;
+	u32 alloc_size;
+	u32 ref_count;
+} GF_SockOutBlock;
+
 typedef struct
 {
 	GF_Socket *socket;
 	Bool is_tuned;
 	char address[GF_MAX_IP_NAME_LEN];
-	Bool pck_pending;
+	//blocks not yet (fully) sent to this client
+	GF_List *pck_queue;
+	//bytes of first queued block already sent, and bytes in queue
+	u32 pck_offset, queued_bytes;
+	u64 start_time, nb_bytes_sent;
+	u32 nb_drop;
 } GF_SockOutClient;
 
+enum
+{
+	SOCKOUT_POL_DROP=0,
+	SOCKOUT_POL_DISC,
+	SOCKOUT_POL_BLOCK,
+};
+
 typedef struct
 {
 	//options
 	Double start, speed;
 	char *dst, *mime, *ext, *ifce;
 	Bool listen;
-	u32 maxc, port, sockbuf, ka, kp, rate, ttl;
+	u32 maxc, port, sockbuf, ka, kp, rate, ttl, crate, cbuf, cpol;
 	GF_Fraction pckr, pckd;
 
 	GF_Socket *socket;
@@ -53,10 +76,12 @@ typedef struct
 	GF_FilterPid *pid;
 
 	GF_List *clients;
+	//client sockets, used to check which clients can be written to
+	GF_SockGroup *sock_group;
+	GF_List *blocks_res;
 
 	Bool pid_started;
 	Bool had_clients;
-	Bool pck_pending;
 
 	GF_FilterCapability in_caps[2];
 	char szExt[10];
@@ -141,7 +166,9 @@ static GF_Err sockout_initialize(GF_Filter *filter)
 
 	if (ctx->listen) {
 		ctx->clients = gf_list_new();
-		if (!ctx->clients) return GF_OUT_OF_MEM;
+		ctx->sock_group = gf_sk_group_new();
+		ctx->blocks_res = gf_list_new();
+		if (!ctx->clients || !ctx->sock_group || !ctx->blocks_res) return GF_OUT_OF_MEM;
 	}
 
 	//static cap, streamtype = file
@@ -238,17 +265,52 @@ static GF_Err sockout_initialize(GF_Filter *filter)
 	return GF_OK;
 }
 
+static void sockout_block_unref(GF_SockOutCtx *ctx, GF_SockOutBlock *blk)
+{
+	gf_fatal_assert(blk->ref_count);
+	blk->ref_count--;
+	if (blk->ref_count) return;
+	if (blk->pck) gf_filter_pck_unref(blk->pck);
+	blk->pck = NULL;
+	blk->data = NULL;
+	gf_list_add(ctx->blocks_res, blk);
+}
+
+static void sockout_del_client(GF_SockOutCtx *ctx, GF_SockOutClient *sc)
+{
+	if (sc->socket) {
+		gf_sk_group_unregister(ctx->sock_group, sc->socket);
+		gf_sk_del(sc->socket);
+	}
+	if (sc->pck_queue) {
+		while (gf_list_count(sc->pck_queue)) {
+			GF_SockOutBlock *blk = gf_list_pop_front(sc->pck_queue);
+			sockout_block_unref(ctx, blk);
+		}
+		gf_list_del(sc->pck_queue);
+	}
+	gf_free(sc);
+}
+
 static void sockout_finalize(GF_Filter *filter)
 {
 	GF_SockOutCtx *ctx = (GF_SockOutCtx *) gf_filter_get_udta(filter);
 	if (ctx->clients) {
 		while (gf_list_count(ctx->clients)) {
 			GF_SockOutClient *sc = gf_list_pop_back(ctx->clients);
-			if (sc->socket) gf_sk_del(sc->socket);
-			gf_free(sc);
+			sockout_del_client(ctx, sc);
 		}
 		gf_list_del(ctx->clients);
 	}
+	if (ctx->blocks_res) {
+		while (gf_list_count(ctx->blocks_res)) {
+			GF_SockOutBlock *blk = gf_list_pop_back(ctx->blocks_res);
+			if (blk->buffer) gf_free(blk->buffer);
+			gf_free(blk);
+		}
+		gf_list_del(ctx->blocks_res);
+	}
+	if (ctx->sock_group) gf_sk_group_del(ctx->sock_group);
 
 	if (ctx->socket) gf_sk_del(ctx->socket);
 }
@@ -323,10 +385,222 @@ static GF_Err sockout_send_packet(GF_SockOutCtx *ctx, GF_FilterPacket *pck, GF_S
 	return GF_OK;
 }
 
+//sends data to the client without blocking, pacing at client rate
+static GF_Err sockout_client_send(GF_SockOutCtx *ctx, GF_SockOutClient *sc, const u8 *data, u32 size, u32 *written)
+{
+	GF_Err e;
+	*written = 0;
+	if (ctx->crate) {
+		u64 now = gf_sys_clock_high_res();
+		if (!sc->start_time) sc->start_time = now;
+		else if (sc->nb_bytes_sent*8*1000000 > ctx->crate * (now - sc->start_time))
+			return GF_OK;
+	}
+	e = gf_sk_send_ex(sc->socket, data, size, written);
+	sc->nb_bytes_sent += *written;
+	if ((e==GF_IP_CONNECTION_CLOSED) || (e==GF_URL_REMOVED)) return GF_IP_CONNECTION_CLOSED;
+	//socket buffer full, wait for next write opportunity
+	if ((e==GF_IP_NETWORK_EMPTY) || (e==GF_BUFFER_TOO_SMALL)) return GF_OK;
+	if (e) {
+		GF_LOG(GF_LOG_ERROR, GF_LOG_NETWORK, ("[SockOut] Write error to client %s: %s\n", sc->address, gf_error_to_string(e) ));
+		//discard data
+		*written = size;
+	}
+	return GF_OK;
+}
+
+//sends as much queued data as possible to the client
+static GF_Err sockout_flush_client(GF_SockOutCtx *ctx, GF_SockOutClient *sc)
+{
+	GF_SockOutBlock *blk;
+	while ((blk = gf_list_get(sc->pck_queue, 0))) {
+		u32 written;
+		GF_Err e = sockout_client_send(ctx, sc, blk->data + sc->pck_offset, blk->size - sc->pck_offset, &written);
+		if (e) return e;
+		sc->pck_offset += written;
+		if (sc->pck_offset < blk->size) break;
+
+		gf_list_rem(sc->pck_queue, 0);
+		sc->queued_bytes -= blk->size;
+		sc->pck_offset = 0;
+		sockout_block_unref(ctx, blk);
+	}
+	return GF_OK;
+}
+
+static Bool sockout_has_pending(GF_SockOutCtx *ctx)
+{
+	u32 i, nb_clients = gf_list_count(ctx->clients);
+	for (i=0; i<nb_clients; i++) {
+		GF_SockOutClient *sc = gf_list_get(ctx->clients, i);
+		if (sc->queued_bytes) return GF_TRUE;
+	}
+	return GF_FALSE;
+}
+
+//flushes queues of all writable clients, returns GF_TRUE if some data is still pending
+static Bool sockout_flush_clients(GF_SockOutCtx *ctx)
+{
+	Bool has_pending = GF_FALSE;
+	u32 i, nb_clients = gf_list_count(ctx->clients);
+
+	if (!sockout_has_pending(ctx)) return GF_FALSE;
+	if (gf_sk_group_select(ctx->sock_group, 0, GF_SK_SELECT_WRITE) != GF_OK) return GF_TRUE;
+
+	for (i=0; i<nb_clients; i++) {
+		GF_SockOutClient *sc = gf_list_get(ctx->clients, i);
+		if (!sc->queued_bytes) continue;
+		if (gf_sk_group_sock_is_set(ctx->sock_group, sc->socket, GF_SK_SELECT_WRITE)) {
+			if (sockout_flush_client(ctx, sc) == GF_IP_CONNECTION_CLOSED) {
+				GF_LOG(GF_LOG_INFO, GF_LOG_NETWORK, ("[SockOut] Client %s disconnected\n", sc->address));
+				gf_list_rem(ctx->clients, i);
+				sockout_del_client(ctx, sc);
+				i--;
+				nb_clients--;
+				continue;
+			}
+		}
+		if (sc->queued_bytes) has_pending = GF_TRUE;
+	}
+	return has_pending;
+}
+
+//creates a block shared by all clients for the packet
+static GF_SockOutBlock *sockout_new_block(GF_SockOutCtx *ctx, GF_FilterPacket *pck, const u8 *data, u32 size)
+{
+	GF_SockOutBlock *blk = gf_list_pop_back(ctx->blocks_res);
+	if (!blk) {
+		GF_SAFEALLOC(blk, GF_SockOutBlock);
+		if (!blk) return NULL;
+	}
+	blk->size = size;
+	//source reuses its buffer once the packet is released, copy the data once so that slow clients do not block it
+	if (gf_filter_pck_is_blocking_ref(pck)) {
+		if (blk->alloc_size < size) {
+			blk->buffer = gf_realloc(blk->buffer, size);
+			if (!blk->buffer) {
+				blk->alloc_size = 0;
+				gf_free(blk);
+				return NULL;
+			}
+			blk->alloc_size = size;
+		}
+		memcpy(blk->buffer, data, size);
+		blk->data = blk->buffer;
+	} else {
+		blk->pck = pck;
+		gf_filter_pck_ref(&blk->pck);
+		blk->data = data;
+	}
+	return blk;
+}
+
+//queues block for the client, applying backlog policy - returns GF_FALSE if client must be disconnected
+static Bool sockout_queue_block(GF_SockOutCtx *ctx, GF_SockOutClient *sc, GF_SockOutBlock *blk)
+{
+	if (ctx->cbuf && sc->queued_bytes && (sc->queued_bytes + blk->size > ctx->cbuf)) {
+		u32 idx, nb_drop = 0;
+		if (ctx->cpol==SOCKOUT_POL_DISC) {
+			GF_LOG(GF_LOG_WARNING, GF_LOG_NETWORK, ("[SockOut] Client %s backlog exceeds %u bytes, disconnecting\n", sc->address, ctx->cbuf));
+			return GF_FALSE;
+		}
+		//drop oldest blocks not yet being sent
+		idx = sc->pck_offset ? 1 : 0;
+		while (sc->queued_bytes + blk->size > ctx->cbuf) {
+			GF_SockOutBlock *old = gf_list_get(sc->pck_queue, idx);
+			if (!old) break;
+			gf_list_rem(sc->pck_queue, idx);
+			sc->queued_bytes -= old->size;
+			sockout_block_unref(ctx, old);
+			nb_drop++;
+		}
+		//remaining backlog is the block being sent, drop new one
+		if (sc->queued_bytes && (sc->queued_bytes + blk->size > ctx->cbuf)) {
+			nb_drop++;
+			sc->nb_drop += nb_drop;
+			GF_LOG(GF_LOG_WARNING, GF_LOG_NETWORK, ("[SockOut] Client %s too slow, dropped %u packets (%u total)\n", sc->address, nb_drop, sc->nb_drop));
+			return GF_TRUE;
+		}
+		sc->nb_drop += nb_drop;
+		GF_LOG(GF_LOG_WARNING, GF_LOG_NETWORK, ("[SockOut] Client %s too slow, dropped %u packets (%u total)\n", sc->address, nb_drop, sc->nb_drop));
+	}
+	blk->ref_count++;
+	gf_list_add(sc->pck_queue, blk);
+	sc->queued_bytes += blk->size;
+	return GF_TRUE;
+}
+
+//sends packet to all clients, returns GF_BUFFER_TOO_SMALL if packet cannot be consumed yet
+static GF_Err sockout_dispatch_packet(GF_SockOutCtx *ctx, GF_FilterPacket *pck)
+{
+	GF_Err e;
+	GF_SockOutBlock *blk = NULL;
+	u32 i, size, nb_clients = gf_list_count(ctx->clients);
+	const u8 *data = gf_filter_pck_get_data(pck, &size);
+
+	if (!data) {
+		//frame interface, wait for all queues to be empty and send in blocking mode
+		if (sockout_has_pending(ctx)) return GF_BUFFER_TOO_SMALL;
+		for (i=0; i<nb_clients; i++) {
+			GF_SockOutClient *sc = gf_list_get(ctx->clients, i);
+			gf_sk_set_block_mode(sc->socket, GF_FALSE);
+			e = sockout_send_packet(ctx, pck, sc->socket);
+			gf_sk_set_block_mode(sc->socket, GF_TRUE);
+			if (e==GF_IP_CONNECTION_CLOSED) {
+				gf_list_rem(ctx->clients, i);
+				sockout_del_client(ctx, sc);
+				i--;
+				nb_clients--;
+			}
+		}
+		return GF_OK;
+	}
+
+	if (ctx->cbuf && (ctx->cpol==SOCKOUT_POL_BLOCK)) {
+		for (i=0; i<nb_clients; i++) {
+			GF_SockOutClient *sc = gf_list_get(ctx->clients, i);
+			if (sc->queued_bytes && (sc->queued_bytes + size > ctx->cbuf))
+				return GF_BUFFER_TOO_SMALL;
+		}
+	}
+
+	for (i=0; i<nb_clients; i++) {
+		u32 written = 0;
+		GF_SockOutClient *sc = gf_list_get(ctx->clients, i);
+		e = GF_OK;
+		//nothing pending for this client, send right away
+		if (!sc->queued_bytes)
+			e = sockout_client_send(ctx, sc, data, size, &written);
+
+		if (!e && (written < size)) {
+			if (!blk) blk = sockout_new_block(ctx, pck, data, size);
+			if (!blk) return GF_OUT_OF_MEM;
+			if (!sc->queued_bytes) sc->pck_offset = written;
+			if (!sockout_queue_block(ctx, sc, blk))
+				e = GF_IP_CONNECTION_CLOSED;
+		}
+		if (e==GF_IP_CONNECTION_CLOSED) {
+			GF_LOG(GF_LOG_INFO, GF_LOG_NETWORK, ("[SockOut] Client %s disconnected\n", sc->address));
+			gf_list_rem(ctx->clients, i);
+			sockout_del_client(ctx, sc);
+			i--;
+			nb_clients--;
+		}
+	}
+	//block not used by any client
+	if (blk && !blk->ref_count) {
+		blk->ref_count = 1;
+		sockout_block_unref(ctx, blk);
+	}
+	ctx->nb_bytes_sent += size;
+	return GF_OK;
+}
+
 static GF_Err sockout_process(GF_Filter *filter)
 {
 	GF_Err e;
 	Bool is_pck_ref = GF_FALSE;
+	Bool has_pending = GF_FALSE;
 
 	GF_FilterPacket *pck;
 	GF_SockOutCtx *ctx = (GF_SockOutCtx *) gf_filter_get_udta(filter);
@@ -357,9 +631,16 @@ static GF_Err sockout_process(GF_Filter *filter)
 		if ((e==GF_OK) && new_conn) {
 			GF_SockOutClient *sc;
 			GF_SAFEALLOC(sc, GF_SockOutClient);
-			if (!sc) return GF_OUT_OF_MEM;
-			
+			if (sc) sc->pck_queue = gf_list_new();
+			if (!sc || !sc->pck_queue) {
+				if (sc) gf_free(sc);
+				gf_sk_del(new_conn);
+				return GF_OUT_OF_MEM;
+			}
+
 			sc->socket = new_conn;
+			gf_sk_set_block_mode(new_conn, GF_TRUE);
+			gf_sk_group_register(ctx->sock_group, new_conn);
 			strcpy(sc->address, "unknown");
 			gf_sk_get_remote_address(new_conn, sc->address);
 
@@ -372,13 +653,13 @@ static GF_Err sockout_process(GF_Filter *filter)
 				gf_filter_pid_send_event(ctx->pid, &evt);
 				ctx->pid_started = GF_TRUE;
 			}
-			sc->pck_pending = ctx->pck_pending;
 			if (!ctx->nb_pck_processed)
 				sc->is_tuned = GF_TRUE;
 		}
 		if (!ctx->pid_started) {
 			gf_filter_ask_rt_reschedule(filter, 50000);
 		}
+		has_pending = sockout_flush_clients(ctx);
 	}
 	if (!ctx->pid) {
 		if (ctx->listen) gf_filter_post_process_task(filter);
@@ -397,14 +678,21 @@ static GF_Err sockout_process(GF_Filter *filter)
 					ctx->socket = NULL;
 					return GF_EOS;
 				}
+				//wait for all clients to receive their data
+				if (has_pending) {
+					gf_filter_ask_rt_reschedule(filter, 1000);
+					return GF_OK;
+				}
 				if (!ctx->ka)
 					return GF_EOS;
 				//keep alive, ask for real-time reschedule of 100 ms - we should use socket groups and selects !
 				gf_filter_ask_rt_reschedule(filter, 100000);
 			}
 		}
-		if (!pck)
+		if (!pck) {
+			if (has_pending) gf_filter_ask_rt_reschedule(filter, 1000);
 			return GF_OK;
+		}
 	}
 
 	if (ctx->pckd.den && !ctx->rev_pck) {
@@ -448,42 +736,17 @@ static GF_Err sockout_process(GF_Filter *filter)
 	}
 
 	if (ctx->listen) {
-		Bool had_pck_pending = ctx->pck_pending;
-		u32 i, nb_clients = gf_list_count(ctx->clients);
-		u8 dep_flags = gf_filter_pck_get_dependency_flags(pck);
-		if ((dep_flags & 0x3) == 1) {
-		}
-		ctx->pck_pending = GF_FALSE;
-
-		for (i=0; i<nb_clients; i++) {
-			GF_SockOutClient *sc = gf_list_get(ctx->clients, i);
-			if (!sc->socket) continue;
-
-			if (!sc->is_tuned) {
-
-			}
-			if (had_pck_pending && !sc->pck_pending) {
-				continue;
-			}
-			sc->pck_pending = GF_FALSE;
-
-			e = sockout_send_packet(ctx, pck, sc->socket);
-			if (e==GF_IP_CONNECTION_CLOSED) {
-				gf_sk_del(sc->socket);
-				sc->socket = NULL;
-				gf_list_rem(ctx->clients, i);
-				gf_free(sc);
-				i--;
-				nb_clients--;
-				continue;
-			}
-			if (e == GF_BUFFER_TOO_SMALL) {
-				sc->pck_pending = GF_TRUE;
-				ctx->pck_pending = GF_TRUE;
+		if (gf_list_count(ctx->clients)) {
+			e = sockout_dispatch_packet(ctx, pck);
+			//some client is blocking, wait for its queue to be flushed
+			if (e==GF_BUFFER_TOO_SMALL) {
+				gf_filter_ask_rt_reschedule(filter, 1000);
+				return GF_OK;
 			}
+			if (e) return e;
 		}
 
-		if (!nb_clients) {
+		if (!gf_list_count(ctx->clients)) {
 			//client disconnected, drop packet if needed
 			if (ctx->had_clients && !ctx->kp) {
 				if (is_pck_ref) {
@@ -495,8 +758,6 @@ static GF_Err sockout_process(GF_Filter *filter)
 			}
 			return GF_OK;
 		}
-		if (ctx->pck_pending) return GF_OK;
-
 	} else {
 		if (gf_sk_select(ctx->socket, GF_SK_SELECT_WRITE)==GF_IP_NETWORK_EMPTY) {
 			gf_filter_ask_rt_reschedule(filter, 1000);
@@ -521,7 +782,10 @@ static GF_Err sockout_process(GF_Filter *filter)
 	} else {
 		gf_filter_pid_drop_packet(ctx->pid);
 		if (ctx->rev_pck) {
-			e = sockout_send_packet(ctx, ctx->rev_pck, ctx->socket);
+			if (ctx->listen)
+				e = sockout_dispatch_packet(ctx, ctx->rev_pck);
+			else
+				e = sockout_send_packet(ctx, ctx->rev_pck, ctx->socket);
 			if (e == GF_BUFFER_TOO_SMALL) return GF_OK;
 			gf_filter_pck_unref(ctx->rev_pck);
 			ctx->rev_pck = NULL;
@@ -529,6 +793,9 @@ static GF_Err sockout_process(GF_Filter *filter)
 			ctx->nb_pckr_wnd++;
 		}
 	}
+	//keep flushing client queues even if no more input
+	if (ctx->listen && sockout_has_pending(ctx))
+		gf_filter_ask_rt_reschedule(filter, 1000);
 	return GF_OK;
 }
 
@@ -561,6 +828,12 @@ static const GF_FilterArgs SockOutArgs[] =
 	{ OFFS(start), "set playback start offset. A negative value means percent of media duration with -1 equal to duration", GF_PROP_DOUBLE, "0.0", NULL, 0},
 	{ OFFS(speed), "set playback speed. If negative and start is 0, start is set to -1", GF_PROP_DOUBLE, "1.0", NULL, 0},
 	{ OFFS(rate), "set send rate in bps, disabled by default (as fast as possible)", GF_PROP_UINT, "0", NULL, GF_FS_ARG_HINT_ADVANCED},
+	{ OFFS(crate), "set send rate in bps for each client in server mode, disabled by default (as fast as possible)", GF_PROP_UINT, "0", NULL, GF_FS_ARG_HINT_ADVANCED},
+	{ OFFS(cbuf), "maximum number of bytes queued for a client in server mode (0 means no limit)", GF_PROP_UINT, "4000000", NULL, GF_FS_ARG_HINT_ADVANCED},
+	{ OFFS(cpol), "policy for clients exceeding [-cbuf]()\n"
+	"- drop: drop oldest packets not yet sent to the client\n"
+	"- disc: disconnect the client\n"
+	"- block: wait for the client before processing more input", GF_PROP_UINT, "block", "drop|disc|block", GF_FS_ARG_HINT_ADVANCED},
 	{ OFFS(pckr), "reverse packet every N", GF_PROP_FRACTION, "0/0", NULL, GF_FS_ARG_HINT_EXPERT},
 	{ OFFS(pckd), "drop packet every N", GF_PROP_FRACTION, "0/0", NULL, GF_FS_ARG_HINT_EXPERT},
 	{ OFFS(ttl), "multicast TTL", GF_PROP_UINT, "0", "0-127", GF_FS_ARG_HINT_EXPERT},
@@ -579,13 +852,17 @@ GF_FilterRegister SockOutRegister = {
 	.name = "sockout",
 	GF_FS_SET_DESCRIPTION("UDP/TCP output")
 #ifndef GPAC_DISABLE_DOC
-	.help = "This filter handles generic output sockets (mono-directional) in blocking mode only.\n"
+	.help = "This filter handles generic output sockets (mono-directional) in blocking mode, except for clients in server mode.\n"
 		"The filter can work in server mode, waiting for source connections, or in client mode, directly connecting to a server.\n"
 		"In server mode, the filter can be instructed to keep running at the end of the stream.\n"
 		"In server mode, the default behavior is to keep input packets when no more clients are connected; "
 		"this can be adjusted though the [-kp]() option, however there is no realtime regulation of how fast packets are dropped.\n"
 		"If your sources are not real time, consider adding a real-time scheduler in the chain (cf reframer filter), or set the send [-rate]() option.\n"
 		"\n"
+		"In server mode, each client has its own send queue referencing input packets, and data is written to a client only when its socket is ready, so that a slow client does not delay other clients.\n"
+		"The [-rate]() option then regulates input consumption, and [-crate]() regulates the rate of each client.\n"
+		"When the queue of a client exceeds [-cbuf]() bytes, the [-cpol]() policy is applied.\n"
+		"\n"
 		"- UDP sockets are used for destinations URLs formatted as `udp://NAME`\n"
 		"- TCP sockets are used for destinations URLs formatted as `tcp://NAME`\n"
 #ifdef GPAC_HAS_SOCK_UN
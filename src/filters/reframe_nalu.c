@@ -71,7 +71,7 @@ typedef struct
 	//filter args
 	GF_Fraction fps;
 	Double index;
-	Bool explicit, force_sync, nosei, importer, subsamples, nosvc, novpsext, deps, seirw, audelim, analyze, notime;
+	Bool explicit, force_sync, nosei, importer, subsamples, nosvc, novpsext, deps, seirw, audelim, analyze, notime, shdr;
 	u32 nal_length;
 	u32 strict_poc;
 	u32 bsdbg;
@@ -201,6 +201,10 @@ typedef struct
 	u32 subsamp_buffer_alloc, subsamp_buffer_size, subs_mapped_bytes;
 	char *subsamp_buffer;
 
+	//NAL size and clear header size pairs of current AU, clear size of last parsed NAL
+	u32 *nal_hdrs;
+	u32 nb_nal_hdrs, nal_hdrs_alloc, nal_clear_size;
+
 	//AVC specific
 	//avc bitstream state
 	AVCState *avc_state;
@@ -353,6 +357,8 @@ GF_Err naludmx_configure_pid(GF_Filter *filter, GF_FilterPid *pid, Bool is_remov
 		if (ctx->avc_state) { gf_free(ctx->avc_state); ctx->avc_state = NULL; }
 		if (ctx->vvc_state) { gf_free(ctx->vvc_state); ctx->vvc_state = NULL; }
 		if (!ctx->hevc_state) GF_SAFEALLOC(ctx->hevc_state, HEVCState);
+		//slice payload offset is only computed when parsing the entire slice header
+		if (ctx->shdr && ctx->hevc_state) ctx->hevc_state->full_slice_header_parse = GF_TRUE;
 		ctx->min_layer_id = 0xFF;
 	} else if (ctx->codecid==GF_CODECID_VVC) {
 		ctx->log_name = "VVC";
@@ -2269,6 +2275,14 @@ static void naludmx_finalize_au_flags(GF_NALUDmxCtx *ctx)
 		ctx->subsamp_buffer_size = 0;
 		ctx->subs_mapped_bytes = 0;
 	}
+	if (ctx->nb_nal_hdrs) {
+		GF_PropertyValue p;
+		p.type = GF_PROP_UINT_LIST;
+		p.value.uint_list.vals = ctx->nal_hdrs;
+		p.value.uint_list.nb_items = ctx->nb_nal_hdrs;
+		gf_filter_pck_set_property(ctx->first_pck_in_au, GF_PROP_PCK_NALU_HDRS, &p);
+		ctx->nb_nal_hdrs = 0;
+	}
 	if (ctx->deps) {
 		u8 flags = 0;
 		//dependsOn
@@ -2348,7 +2362,10 @@ GF_FilterPacket *naludmx_start_nalu(GF_NALUDmxCtx *ctx, u32 nal_size, Bool skip_
 
 	if (*au_start) {
 		ctx->first_pck_in_au = dst_pck;
+		ctx->nb_nal_hdrs = 0;
 		if (ctx->src_pck) gf_filter_pck_merge_properties(ctx->src_pck, dst_pck);
+		//drop any NAL header info from source, it no longer matches our output
+		if (ctx->shdr) gf_filter_pck_set_property(dst_pck, GF_PROP_PCK_NALU_HDRS, NULL);
 
 		gf_filter_pck_set_framing(dst_pck, GF_TRUE, GF_FALSE);
 		//we reuse the timing of the input packet for the first nal of the first frame starting in this packet
@@ -2387,6 +2404,22 @@ GF_FilterPacket *naludmx_start_nalu(GF_NALUDmxCtx *ctx, u32 nal_size, Bool skip_
 	return dst_pck;
 }
 
+static void naludmx_add_nal_hdr(GF_NALUDmxCtx *ctx, u32 nal_size, u32 clear_size)
+{
+	//not supported for VVC
+	if (!ctx->shdr || ctx->vvc_state) return;
+	if (ctx->nal_hdrs_alloc < ctx->nb_nal_hdrs + 2) {
+		ctx->nal_hdrs_alloc = ctx->nb_nal_hdrs + 20;
+		ctx->nal_hdrs = gf_realloc(ctx->nal_hdrs, sizeof(u32) * ctx->nal_hdrs_alloc);
+		if (!ctx->nal_hdrs) {
+			ctx->nal_hdrs_alloc = ctx->nb_nal_hdrs = 0;
+			return;
+		}
+	}
+	ctx->nal_hdrs[ctx->nb_nal_hdrs++] = nal_size;
+	ctx->nal_hdrs[ctx->nb_nal_hdrs++] = clear_size;
+}
+
 void naludmx_add_subsample(GF_NALUDmxCtx *ctx, u32 subs_size, u8 subs_priority, u32 subs_reserved)
 {
 	if (ctx->subsamp_buffer_alloc < ctx->subsamp_buffer_size+14 ) {
@@ -2439,6 +2472,13 @@ static s32 naludmx_parse_nal_hevc(GF_NALUDmxCtx *ctx, char *data, u32 size, Bool
 	gf_bs_reassign_buffer(ctx->bs_r, data, size);
 	res = gf_hevc_parse_nalu_bs(ctx->bs_r, ctx->hevc_state, &nal_unit_type, &temporal_id, &layer_id);
 	ctx->nb_nalus++;
+	if (ctx->shdr) {
+		if ((res>=0) && (nal_unit_type<=GF_HEVC_NALU_SLICE_CRA))
+			ctx->nal_clear_size = ctx->hevc_state->s_info.payload_start_offset;
+		else
+			ctx->nal_clear_size = size;
+		gf_bs_enable_emulation_byte_removal(ctx->bs_r, GF_FALSE);
+	}
 
 	if (res < 0) {
 		if (res == -1) {
@@ -2798,6 +2838,22 @@ static s32 naludmx_parse_nal_avc(GF_NALUDmxCtx *ctx, char *data, u32 size, u32 n
 	gf_bs_reassign_buffer(ctx->bs_r, data, size);
 	*skip_nal = GF_FALSE;
 	res = gf_avc_parse_nalu(ctx->bs_r, ctx->avc_state);
+	if (ctx->shdr) {
+		ctx->nal_clear_size = size;
+		switch (nal_type) {
+		case GF_AVC_NALU_NON_IDR_SLICE:
+		case GF_AVC_NALU_DP_A_SLICE:
+		case GF_AVC_NALU_DP_B_SLICE:
+		case GF_AVC_NALU_DP_C_SLICE:
+		case GF_AVC_NALU_IDR_SLICE:
+		case GF_AVC_NALU_SLICE_AUX:
+		case GF_AVC_NALU_SVC_SLICE:
+			gf_bs_align(ctx->bs_r);
+			ctx->nal_clear_size = (u32) gf_bs_get_position(ctx->bs_r);
+			break;
+		}
+		gf_bs_enable_emulation_byte_removal(ctx->bs_r, GF_FALSE);
+	}
 	if (res < 0) {
 		if (res == -1) {
 			GF_LOG(GF_LOG_ERROR, GF_LOG_MEDIA, ("[%s] Error parsing NAL unit type %u\n", ctx->log_name, nal_type));
@@ -3878,6 +3934,7 @@ naldmx_flush:
 			u32 audelim_size = (ctx->codecid!=GF_CODECID_AVC) ? 3 : 2;
 			/*dst_pck = */naludmx_start_nalu(ctx, audelim_size, GF_FALSE, &au_start, &pck_data);
 			memcpy(pck_data + ctx->nal_length , ctx->init_aud, audelim_size);
+			naludmx_add_nal_hdr(ctx, audelim_size, audelim_size);
 			ctx->has_initial_aud = GF_FALSE;
 			if (ctx->subsamples) {
 				naludmx_add_subsample(ctx, audelim_size, avc_svc_subs_priority, avc_svc_subs_reserved);
@@ -3887,6 +3944,16 @@ naldmx_flush:
 			//sei buffer is already nal size prefixed
 			/*dst_pck = */naludmx_start_nalu(ctx, ctx->sei_buffer_size, GF_TRUE, &au_start, &pck_data);
 			memcpy(pck_data, ctx->sei_buffer, ctx->sei_buffer_size);
+			if (ctx->shdr) {
+				u32 sei_pos = 0;
+				while (sei_pos + ctx->nal_length <= ctx->sei_buffer_size) {
+					u32 k, sei_size = 0;
+					for (k=0; k<ctx->nal_length; k++)
+						sei_size = (sei_size<<8) | (u8) ctx->sei_buffer[sei_pos+k];
+					naludmx_add_nal_hdr(ctx, sei_size, sei_size);
+					sei_pos += ctx->nal_length + sei_size;
+				}
+			}
 			if (ctx->subsamples) {
 				naludmx_add_subsample(ctx, ctx->sei_buffer_size - ctx->nal_length, avc_svc_subs_priority, avc_svc_subs_reserved);
 			}
@@ -3896,6 +3963,7 @@ naldmx_flush:
 		if (ctx->svc_prefix_buffer_size) {
 			/*dst_pck = */naludmx_start_nalu(ctx, ctx->svc_prefix_buffer_size, GF_FALSE, &au_start, &pck_data);
 			memcpy(pck_data + ctx->nal_length, ctx->svc_prefix_buffer, ctx->svc_prefix_buffer_size);
+			naludmx_add_nal_hdr(ctx, ctx->svc_prefix_buffer_size, ctx->svc_prefix_buffer_size);
 			if (ctx->subsamples) {
 				naludmx_add_subsample(ctx, ctx->svc_prefix_buffer_size, ctx->svc_nalu_prefix_priority, ctx->svc_nalu_prefix_reserved);
 			}
@@ -3910,6 +3978,7 @@ naldmx_flush:
 		if (ctx->subsamples) {
 			naludmx_add_subsample(ctx, (u32) nal_size, avc_svc_subs_priority, avc_svc_subs_reserved);
 		}
+		naludmx_add_nal_hdr(ctx, (u32) nal_size, ctx->nal_clear_size);
 
 
 		//bytes only come from the data packet
@@ -4105,6 +4174,7 @@ static void naludmx_finalize(GF_Filter *filter)
 	if (ctx->sei_buffer) gf_free(ctx->sei_buffer);
 	if (ctx->svc_prefix_buffer) gf_free(ctx->svc_prefix_buffer);
 	if (ctx->subsamp_buffer) gf_free(ctx->subsamp_buffer);
+	if (ctx->nal_hdrs) gf_free(ctx->nal_hdrs);
 
 	if (ctx->src_pck) gf_filter_pck_unref(ctx->src_pck);
 	ctx->src_pck = NULL;
@@ -4307,6 +4377,7 @@ static const GF_FilterArgs NALUDmxArgs[] =
 	{ OFFS(nal_length), "set number of bytes used to code length field: 1, 2 or 4", GF_PROP_UINT, "4", NULL, GF_FS_ARG_HINT_EXPERT},
 	{ OFFS(subsamples), "import subsamples information", GF_PROP_BOOL, "false", NULL, GF_FS_ARG_HINT_EXPERT},
 	{ OFFS(deps), "import sample dependency information", GF_PROP_BOOL, "false", NULL, GF_FS_ARG_HINT_EXPERT},
+	{ OFFS(shdr), "export NAL unit sizes and slice header sizes of AVC and HEVC samples as packet property, used by encryptors to avoid slice header parsing", GF_PROP_BOOL, "false", NULL, GF_FS_ARG_HINT_EXPERT},
 	{ OFFS(seirw), "rewrite AVC sei messages for ISOBMFF constraints", GF_PROP_BOOL, "true", NULL, GF_FS_ARG_HINT_EXPERT},
 	{ OFFS(audelim), "keep Access Unit delimiter in payload", GF_PROP_BOOL, "false", NULL, GF_FS_ARG_HINT_EXPERT},
 	{ OFFS(analyze), "skip reformat of decoder config and SEI and dispatch all NAL in input order - shall only be used with inspect filter analyze mode!", GF_PROP_UINT, "off", "off|on|bs|full", GF_FS_ARG_HINT_HIDE},
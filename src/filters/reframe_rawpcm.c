@@ -51,6 +51,9 @@ typedef struct
 	Bool init_skip;
 	u8 *probe_data;
 	u32 probe_data_size;
+	//scratch for one interleaved sample in reverse play
+	u8 *rev_sample;
+	u32 rev_sample_size;
 } GF_PCMReframeCtx;
 
 
@@ -212,11 +215,21 @@ void pcmreframe_flush_packet(GF_PCMReframeCtx *ctx)
 	if (ctx->reverse_play) {
 		u32 i, nb_bytes_in_sample, nb_samples = ctx->nb_bytes_in_frame / ctx->Bps / ctx->ch;
 		nb_bytes_in_sample = ctx->Bps * ctx->ch;
+		if (ctx->rev_sample_size < nb_bytes_in_sample) {
+			ctx->rev_sample = gf_realloc(ctx->rev_sample, nb_bytes_in_sample);
+			if (!ctx->rev_sample) {
+				ctx->rev_sample_size = 0;
+				nb_samples = 0;
+			} else {
+				ctx->rev_sample_size = nb_bytes_in_sample;
+			}
+		}
 		for (i=0; i<nb_samples/2; i++) {
-			char store[100];
-			memcpy(store, ctx->out_data + i*nb_bytes_in_sample, nb_bytes_in_sample);
-			memcpy(ctx->out_data + i*nb_bytes_in_sample, ctx->out_data + (nb_samples - i - 1)*nb_bytes_in_sample, nb_bytes_in_sample);
-			memcpy(ctx->out_data + (nb_samples-i-1)*nb_bytes_in_sample, store, nb_bytes_in_sample);
+			u8 *first = ctx->out_data + i*nb_bytes_in_sample;
+			u8 *last = ctx->out_data + (nb_samples - i - 1)*nb_bytes_in_sample;
+			memcpy(ctx->rev_sample, first, nb_bytes_in_sample);
+			memcpy(first, last, nb_bytes_in_sample);
+			memcpy(last, ctx->rev_sample, nb_bytes_in_sample);
 		}
 	}
 	gf_filter_pck_send(ctx->out_pck);
@@ -490,6 +503,7 @@ static void pcmreframe_finalize(GF_Filter *filter)
 	GF_PCMReframeCtx *ctx = gf_filter_get_udta(filter);
 	if (ctx->out_pck) gf_filter_pck_discard(ctx->out_pck);
 	if (ctx->probe_data) gf_free(ctx->probe_data);
+	if (ctx->rev_sample) gf_free(ctx->rev_sample);
 }
 
 static GF_FilterCapability PCMReframeCaps[] =
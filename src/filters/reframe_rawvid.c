@@ -211,7 +211,8 @@ static Bool rawvidreframe_process_event(GF_Filter *filter, const GF_FilterEvent
 		if (!ctx->initial_play_done) {
 			ctx->initial_play_done = GF_TRUE;
 			//seek will not change the current source state, don't send a seek
-			if (!ctx->filepos)
+			//unless referencing source data, in which case we want the source to dispatch one frame per block
+			if (!ctx->filepos && (ctx->copy || ctx->is_yuv4mpeg))
 				return GF_TRUE;
 		}
 
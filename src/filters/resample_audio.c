@@ -34,6 +34,7 @@ typedef struct
 {
 	//opts
 	u32 och, osr, osfmt;
+	Bool dither;
 
 	//internal
 	GF_FilterPid *ipid, *opid;
@@ -136,6 +137,7 @@ static GF_Err resample_initialize(GF_Filter *filter)
 	GF_ResampleCtx *ctx = gf_filter_get_udta(filter);
 	ctx->mixer = gf_mixer_new(NULL);
 	if (!ctx->mixer) return GF_OUT_OF_MEM;
+	gf_mixer_set_dither(ctx->mixer, ctx->dither);
 
 	ctx->input_ai.callback = ctx;
 	ctx->input_ai.FetchFrame = resample_fetch_frame;
@@ -467,6 +469,7 @@ static GF_FilterArgs ResamplerArgs[] =
 	{ OFFS(osr), "desired sample rate of output audio (0 for auto)", GF_PROP_UINT, "0", NULL, 0},
 	{ OFFS(osfmt), "desired sample format of output audio (`none` for auto)", GF_PROP_PCMFMT, "none", NULL, 0},
 	{ OFFS(olayout), "desired CICP layout of output audio (null for auto)", GF_PROP_CICP_LAYOUT, NULL, NULL, 0},
+	{ OFFS(dither), "apply triangular dither when reducing sample bit depth", GF_PROP_BOOL, "false", NULL, GF_FS_ARG_HINT_ADVANCED},
 	{0}
 };
 
@@ -0,0 +1,95 @@
+#include "tests.h"
+#include <gpac/filters.h>
+
+//burn-in of an SRT stream on a raw video: every input frame must be sent, untouched outside the cue,
+//blended during the cue, and the session must end once the video is done
+
+#define BURNIN_W        320
+#define BURNIN_H        240
+#define BURNIN_NB_FRAMES 50
+
+static GF_Err burnin_run(const char *src, const char *subs, const char *comp, const char *dst)
+{
+    GF_Err e = GF_OK;
+    GF_Filter *f_src, *f_subs, *f_last, *f_dst;
+    GF_FilterSession *fs = gf_fs_new_defaults(0);
+    if (!fs) return GF_OUT_OF_MEM;
+
+    f_src = f_last = gf_fs_load_source(fs, src, NULL, NULL, &e);
+    if (!e && comp) {
+        f_last = gf_fs_load_filter(fs, comp, &e);
+        if (!e) e = gf_filter_set_source(f_last, f_src, NULL);
+        if (!e) f_subs = gf_fs_load_source(fs, subs, NULL, NULL, &e);
+        if (!e) e = gf_filter_set_source(f_last, f_subs, NULL);
+    }
+    if (!e) {
+        f_dst = gf_fs_load_destination(fs, dst, NULL, NULL, &e);
+        if (!e) e = gf_filter_set_source(f_dst, f_last, NULL);
+    }
+    if (!e) e = gf_fs_run(fs);
+    if (e==GF_EOS) e = GF_OK;
+    if (!e) e = gf_fs_get_last_process_error(fs);
+    if (!e) e = gf_fs_get_last_connect_error(fs);
+    gf_fs_del(fs);
+    return e;
+}
+
+//returns pointer to first frame payload, frames are "FRAME\n" + yuv420 data
+static u8 *burnin_get_frames(u8 *data, u32 size, u32 *nb_frames)
+{
+    u32 frame_size = 6 + BURNIN_W * BURNIN_H * 3 / 2;
+    u8 *sep = memchr(data, '\n', size);
+    if (!sep) return NULL;
+    sep++;
+    *nb_frames = (u32) (size - (sep - data)) / frame_size;
+    return sep;
+}
+
+unittest(compose_burnin_y4m_srt)
+{
+    char src[GF_MAX_PATH], subs[GF_MAX_PATH], dst[GF_MAX_PATH];
+    u8 *src_data, *dst_data, *src_frames, *dst_frames;
+    u32 i, src_size, dst_size, nb_src, nb_dst;
+    u32 frame_size = 6 + BURNIN_W * BURNIN_H * 3 / 2;
+    const char *dir;
+    FILE *f;
+
+    gf_sys_init(GF_MemTrackerNone, NULL);
+    dir = gf_get_default_cache_directory();
+    sprintf(src, "%s/ut_burnin_src.y4m", dir);
+    sprintf(subs, "%s/ut_burnin.srt", dir);
+    sprintf(dst, "%s/ut_burnin_dst.y4m", dir);
+
+    //2s at 25 fps
+    assert_equal(burnin_run("avgen:a=0:sizes=320x240:dur=2", NULL, NULL, src), GF_OK);
+
+    f = gf_fopen(subs, "wb");
+    assert_not_null(f);
+    gf_fputs("1\n00:00:00,500 --> 00:00:01,000\nBurn\n", f);
+    gf_fclose(f);
+
+    assert_equal(burnin_run(src, subs, "compositor:burnin", dst), GF_OK);
+
+    assert_equal(gf_file_load_data(src, &src_data, &src_size), GF_OK);
+    assert_equal(gf_file_load_data(dst, &dst_data, &dst_size), GF_OK);
+    src_frames = burnin_get_frames(src_data, src_size, &nb_src);
+    dst_frames = burnin_get_frames(dst_data, dst_size, &nb_dst);
+    assert_not_null(src_frames);
+    assert_not_null(dst_frames);
+    assert_equal(nb_src, BURNIN_NB_FRAMES);
+    assert_equal(nb_dst, nb_src);
+
+    for (i=0; i<nb_dst; i++) {
+        Bool same = !memcmp(src_frames + i*frame_size, dst_frames + i*frame_size, frame_size);
+        //cue is active from 500 to 1000 ms, i.e. frames 13 to 24 (applied on the first frame after cue start)
+        if ((i<12) || (i>=25)) assert_true(same);
+        else if ((i>13) && (i<24)) assert_false(same);
+    }
+
+    gf_free(src_data);
+    gf_free(dst_data);
+    gf_file_delete(src);
+    gf_file_delete(subs);
+    gf_file_delete(dst);
+    gf_sys_close();
+}
@@ -0,0 +1,137 @@
+#include "tests.h"
+#include <gpac/filters.h>
+#include <gpac/bitstream.h>
+#include <gpac/network.h>
+
+//onDemand packaging of a multi-track ISOBMFF source: when the dasher is fed by the ISOBMFF demuxer, the segment count
+//is computed from the source sample tables and the sidx is written at its exact size. When another filter sits between
+//the demuxer and the dasher, the muxer must keep its padded sidx reservation
+
+#define SRCSEGS_DUR    "60"
+
+static GF_Err srcsegs_run(const char *src, const char *mid_filter, const char *dst, const char *dst_args)
+{
+    GF_Err e = GF_OK;
+    GF_Filter *f_src, *f_mid=NULL, *f_dst;
+    GF_FilterSession *fs = gf_fs_new_defaults(0);
+    if (!fs) return GF_OUT_OF_MEM;
+
+    f_src = gf_fs_load_source(fs, src, NULL, NULL, &e);
+    if (!e && mid_filter) {
+        f_mid = gf_fs_load_filter(fs, mid_filter, &e);
+        if (!e) e = gf_filter_set_source(f_mid, f_src, NULL);
+    }
+    if (!e) {
+        f_dst = gf_fs_load_destination(fs, dst, dst_args, NULL, &e);
+        if (!e) e = gf_filter_set_source(f_dst, f_mid ? f_mid : f_src, NULL);
+    }
+    if (!e) e = gf_fs_run(fs);
+    if (e==GF_EOS) e = GF_OK;
+    if (!e) e = gf_fs_get_last_process_error(fs);
+    if (!e) e = gf_fs_get_last_connect_error(fs);
+    gf_fs_del(fs);
+    return e;
+}
+
+//checks top-level boxes: sidx must index all bytes up to end of file
+//returns the size of the padding (free box) before the sidx, -1 if error
+static s32 srcsegs_check_file(const char *name, u32 *nb_refs)
+{
+    s32 padding = -1;
+    u64 prev_free = 0;
+    FILE *f = gf_fopen(name, "rb");
+    if (!f) return -1;
+    GF_BitStream *bs = gf_bs_from_file(f, GF_BITSTREAM_READ);
+    u64 file_size = gf_bs_get_size(bs);
+    *nb_refs = 0;
+
+    while (gf_bs_available(bs) >= 8) {
+        u64 start = gf_bs_get_position(bs);
+        u64 size = gf_bs_read_u32(bs);
+        u32 type = gf_bs_read_u32(bs);
+        if (size==1) size = gf_bs_read_u64(bs);
+        if (size<8) break;
+
+        //first sidx only, indexes the rest of the file
+        if (type == GF_4CC('s','i','d','x')) {
+            u32 i, version, count;
+            u64 first_offset, ref_size = 0;
+            version = gf_bs_read_u8(bs);
+            gf_bs_read_int(bs, 24);
+            gf_bs_read_u32(bs);
+            gf_bs_read_u32(bs);
+            if (version) {
+                gf_bs_read_u64(bs);
+                first_offset = gf_bs_read_u64(bs);
+            } else {
+                gf_bs_read_u32(bs);
+                first_offset = gf_bs_read_u32(bs);
+            }
+            gf_bs_read_u16(bs);
+            count = gf_bs_read_u16(bs);
+            for (i=0; i<count; i++) {
+                gf_bs_read_int(bs, 1);
+                ref_size += gf_bs_read_int(bs, 31);
+                gf_bs_read_u32(bs);
+                gf_bs_read_u32(bs);
+            }
+            *nb_refs = count;
+            if (start + size + first_offset + ref_size == file_size)
+                padding = (s32) prev_free;
+            break;
+        }
+        prev_free = (type == GF_4CC('f','r','e','e')) ? size : 0;
+        gf_bs_seek(bs, start + size);
+    }
+    gf_bs_del(bs);
+    gf_fclose(f);
+    return padding;
+}
+
+static void srcsegs_package(const char *mid_filter, Bool exact)
+{
+    char src[GF_MAX_PATH], mpd[GF_MAX_PATH], rep[GF_MAX_PATH];
+    u32 i, nb_refs;
+    const char *dir = gf_get_default_cache_directory();
+
+    sprintf(src, "%s/ut_srcsegs.mp4", dir);
+    sprintf(mpd, "%s/ut_srcsegs.mpd", dir);
+
+    if (!gf_file_exists(src)) {
+        assert_equal(srcsegs_run("avgen:sizes=32x32:dur="SRCSEGS_DUR, NULL, src, NULL), GF_OK);
+    }
+    assert_equal(srcsegs_run(src, mid_filter, mpd, "profile=onDemand:segdur=1"), GF_OK);
+
+    //one representation per track
+    for (i=1; i<=2; i++) {
+        sprintf(rep, "%s/ut_srcsegs_track%d__dashinit.mp4", dir, i);
+        s32 padding = srcsegs_check_file(rep, &nb_refs);
+        assert_greater_equal(padding, 0);
+        //exact count: at most the two extra entries reserved for timestamp shifts, otherwise 10% margin and free box
+        if (exact)
+            assert_less_equal(padding, 8 + 2*12);
+        else
+            assert_greater(padding, 8 + 2*12);
+        assert_greater_equal(nb_refs, atoi(SRCSEGS_DUR));
+        gf_file_delete(rep);
+    }
+    gf_file_delete(mpd);
+}
+
+unittest(dasher_srcsegs_exact_sidx)
+{
+    gf_sys_init(GF_MemTrackerNone, NULL);
+    srcsegs_package(NULL, GF_TRUE);
+    gf_sys_close();
+}
+
+unittest(dasher_srcsegs_reserve_kept)
+{
+    char src[GF_MAX_PATH];
+    gf_sys_init(GF_MemTrackerNone, NULL);
+    //packets no longer come from the demuxer, file sample tables must not be trusted
+    srcsegs_package("reframer", GF_FALSE);
+    sprintf(src, "%s/ut_srcsegs.mp4", gf_get_default_cache_directory());
+    gf_file_delete(src);
+    gf_sys_close();
+}
@@ -199,6 +199,25 @@ unittest(scte35dec_splice_point_with_idr)
 
 /*************************************/
 
+unittest(scte35dec_repeated_section)
+{
+    SCTE35DecCtx ctx = {0};
+    assert_equal(scte35dec_initialize_internal(&ctx), GF_OK);
+    ctx.pass = GF_TRUE;
+
+    u64 pts = 0;
+    SEND_EVENT(TIMESCALE/FPS);
+    SEND_EVENT(TIMESCALE/FPS); // same section sent again, not scheduled twice
+    assert_equal(gf_list_count(ctx.ordered_events), 1);
+    assert_true(scte35dec_is_splice_point(&ctx, SCTE35_PTS));
+    assert_equal(gf_list_count(ctx.ordered_events), 0);
+
+    scte35dec_flush(&ctx);
+    scte35dec_finalize_internal(&ctx);
+}
+
+/*************************************/
+
 static GF_Err pck_send_simple(GF_FilterPacket *pck)
 {
     #define expected_calls 4 //FIXME: if we put 5 then we have some drift control that triggers a final EMEB box
@@ -0,0 +1,132 @@
+#include "tests.h"
+#include <gpac/filters.h>
+#include <gpac/thread.h>
+
+//ROUTE loopback: a live DASH session is sent over multicast by a sender session running in its own thread,
+//and received in files by the ROUTE demuxer with and without worker threads. Segments must be identical
+
+#define RT_ADDR         "route://225.1.1.4:6300"
+#define RT_W            64
+#define RT_H            64
+#define RT_NB_FRAMES    100
+
+static GF_Err route_run(const char *src, const char *dst)
+{
+    GF_Err e = GF_OK;
+    GF_Filter *f_src, *f_dst;
+    GF_FilterSession *fs = gf_fs_new_defaults(0);
+    if (!fs) return GF_OUT_OF_MEM;
+
+    f_src = gf_fs_load_source(fs, src, NULL, NULL, &e);
+    if (!e) {
+        f_dst = gf_fs_load_destination(fs, dst, NULL, NULL, &e);
+        if (!e) e = gf_filter_set_source(f_dst, f_src, NULL);
+    }
+    if (!e) e = gf_fs_run(fs);
+    if (e==GF_EOS) e = GF_OK;
+    if (!e) e = gf_fs_get_last_process_error(fs);
+    if (!e) e = gf_fs_get_last_connect_error(fs);
+    gf_fs_del(fs);
+    return e;
+}
+
+//4s of 25 fps raw video, each frame with different content
+static void route_make_source(const char *y4m)
+{
+    u32 i, k, frame_size = RT_W * RT_H * 3 / 2;
+    u8 *frame = gf_malloc(frame_size);
+    FILE *f = gf_fopen(y4m, "wb");
+    assert_not_null(f);
+    gf_fprintf(f, "YUV4MPEG2 W%d H%d F25:1 Ip A1:1 C420jpeg\n", RT_W, RT_H);
+    for (i=0; i<RT_NB_FRAMES; i++) {
+        for (k=0; k<frame_size; k++)
+            frame[k] = (u8) (i*7 + k);
+        gf_fputs("FRAME\n", f);
+        gf_fwrite(frame, frame_size, f);
+    }
+    gf_fclose(f);
+    gf_free(frame);
+}
+
+static u32 route_sender(void *par)
+{
+    route_run((const char *) par, RT_ADDR"/ut_route.mpd:dmode=dynamic:profile=live");
+    return 0;
+}
+
+//receives the session in odir, the receiver socket being ready before the sender starts
+static void route_receive(const char *src, const char *odir, u32 nb_threads)
+{
+    char szSrc[GF_MAX_PATH];
+    GF_Err e = GF_OK;
+    GF_Thread *th;
+    GF_FilterSession *fs = gf_fs_new_defaults(0);
+    assert_not_null(fs);
+
+    sprintf(szSrc, RT_ADDR":odir=%s:nbth=%d:timeout=2000:stats=0", odir, nb_threads);
+    gf_fs_load_source(fs, szSrc, NULL, NULL, &e);
+    assert_equal(e, GF_OK);
+
+    th = gf_th_new("ROUTESender");
+    assert_not_null(th);
+    assert_equal(gf_th_run(th, route_sender, (void *) src), GF_OK);
+    e = gf_fs_run(fs);
+    if (e==GF_EOS) e = GF_OK;
+    assert_equal(e, GF_OK);
+    gf_th_del(th);
+    gf_fs_del(fs);
+}
+
+static Bool route_same_file(const char *file1, const char *file2)
+{
+    u8 *data1, *data2;
+    u32 size1, size2;
+    Bool same;
+    if (gf_file_load_data(file1, &data1, &size1)) return GF_FALSE;
+    if (gf_file_load_data(file2, &data2, &size2)) {
+        gf_free(data1);
+        return GF_FALSE;
+    }
+    same = ((size1==size2) && !memcmp(data1, data2, size1)) ? GF_TRUE : GF_FALSE;
+    gf_free(data1);
+    gf_free(data2);
+    return same;
+}
+
+unittest(route_worker_threads_loopback)
+{
+    char y4m[GF_MAX_PATH], src[GF_MAX_PATH], odir[2][GF_MAX_PATH], seg[2][GF_MAX_PATH];
+    u32 i, k, nb_segs = 0;
+    const char *dir;
+
+    gf_sys_init(GF_MemTrackerNone, NULL);
+    dir = gf_get_default_cache_directory();
+    sprintf(y4m, "%s/ut_route_src.y4m", dir);
+    sprintf(src, "%s/ut_route_src.mp4", dir);
+    sprintf(odir[0], "%s/ut_route_nbth0", dir);
+    sprintf(odir[1], "%s/ut_route_nbth2", dir);
+
+    route_make_source(y4m);
+    assert_equal(route_run(y4m, src), GF_OK);
+
+    route_receive(src, odir[0], 0);
+    route_receive(src, odir[1], 2);
+
+    //1s segments, a segment missed by the first receiver is not checked
+    for (k=1; k<=RT_NB_FRAMES/25; k++) {
+        sprintf(seg[0], "%s/service1/ut_route_src_dash%d.m4s", odir[0], k);
+        sprintf(seg[1], "%s/service1/ut_route_src_dash%d.m4s", odir[1], k);
+        if (!gf_file_exists(seg[0])) continue;
+        assert_true(route_same_file(seg[0], seg[1]));
+        nb_segs++;
+    }
+    assert_greater_equal(nb_segs, 2);
+
+    gf_file_delete(y4m);
+    gf_file_delete(src);
+    for (i=0; i<2; i++) {
+        gf_dir_cleanup(odir[i]);
+        gf_rmdir(odir[i]);
+    }
+    gf_sys_close();
+}
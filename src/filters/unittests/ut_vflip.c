@@ -0,0 +1,129 @@
+#include "tests.h"
+#include "../vflip.c"
+
+//flips a single-plane packed frame, source lines padded to check stride handling
+static u8 *vflip_run(GF_VFlipCtx *ctx, u32 pfmt, u32 w, u32 h, u32 mode, const u8 *src, u32 wiB)
+{
+    u8 *dst;
+    memset(ctx, 0, sizeof(GF_VFlipCtx));
+    ctx->mode = mode;
+    ctx->s_pfmt = pfmt;
+    ctx->w = ctx->dst_width = w;
+    ctx->h = ctx->dst_height = h;
+    ctx->nb_planes = ctx->nb_src_planes = 1;
+    ctx->bps = gf_pixel_get_bytes_per_pixel(pfmt);
+    ctx->src_stride[0] = wiB + 8;
+    ctx->dst_stride[0] = wiB;
+    switch (pfmt) {
+    case GF_PIXEL_YUYV:
+    case GF_PIXEL_YVYU:
+    case GF_PIXEL_UYVY:
+    case GF_PIXEL_VYUY:
+    case GF_PIXEL_YUYV_10:
+    case GF_PIXEL_YVYU_10:
+    case GF_PIXEL_UYVY_10:
+    case GF_PIXEL_VYUY_10:
+        ctx->packed_422 = GF_TRUE;
+        break;
+    }
+    dst = gf_malloc(wiB * h);
+    memset(dst, 0xAA, wiB * h);
+    flip_plane(ctx, src, dst, h, 0, wiB);
+    return dst;
+}
+
+static u8 *vflip_make_src(u32 wiB, u32 h)
+{
+    u32 i, stride = wiB + 8;
+    u8 *src = gf_malloc(stride * h);
+    for (i=0; i<stride*h; i++)
+        src[i] = (u8) (i*7 + i/251);
+    return src;
+}
+
+//packed RGB: each pixel of bpp bytes moves as a whole, channel order unchanged
+static void vflip_check_rgb(u32 pfmt, u32 w, u32 h, u32 mode)
+{
+    GF_VFlipCtx ctx;
+    u32 x, y, bpp = gf_pixel_get_bytes_per_pixel(pfmt);
+    u32 wiB = w * bpp;
+    u8 *src = vflip_make_src(wiB, h);
+    u8 *dst = vflip_run(&ctx, pfmt, w, h, mode, src, wiB);
+
+    for (y=0; y<h; y++) {
+        for (x=0; x<w; x++) {
+            u32 sx = (mode==VFLIP_VERT) ? x : (w-1-x);
+            u32 sy = (mode==VFLIP_HORIZ) ? y : (h-1-y);
+            assert_equal(memcmp(dst + y*wiB + x*bpp, src + sy*(wiB+8) + sx*bpp, bpp), 0);
+        }
+    }
+    gf_free(src);
+    gf_free(dst);
+}
+
+unittest(vflip_packed_rgb)
+{
+    vflip_check_rgb(GF_PIXEL_RGB, 5, 3, VFLIP_HORIZ);
+    vflip_check_rgb(GF_PIXEL_BGR, 16, 4, VFLIP_BOTH);
+    vflip_check_rgb(GF_PIXEL_RGB, 7, 5, VFLIP_VERT);
+    vflip_check_rgb(GF_PIXEL_RGBX, 9, 2, VFLIP_HORIZ);
+    vflip_check_rgb(GF_PIXEL_XBGR, 8, 3, VFLIP_BOTH);
+    vflip_check_rgb(GF_PIXEL_RGBA, 3, 3, VFLIP_HORIZ);
+    vflip_check_rgb(GF_PIXEL_RGB_565, 11, 2, VFLIP_HORIZ);
+    vflip_check_rgb(GF_PIXEL_GREYSCALE, 13, 2, VFLIP_BOTH);
+}
+
+//packed 422: luma samples are mirrored, chroma pairs follow their macro-pixel
+static void vflip_check_422(u32 pfmt, u32 w, u32 h, u32 mode)
+{
+    GF_VFlipCtx ctx;
+    u32 x, y, k, y_off, u_off;
+    u32 bps = gf_pixel_get_bytes_per_pixel(pfmt);
+    u32 wiB = w * 2 * bps;
+    u8 *src = vflip_make_src(wiB, h);
+    u8 *dst = vflip_run(&ctx, pfmt, w, h, mode, src, wiB);
+
+    switch (pfmt) {
+    case GF_PIXEL_UYVY:
+    case GF_PIXEL_VYUY:
+    case GF_PIXEL_UYVY_10:
+    case GF_PIXEL_VYUY_10:
+        y_off = 1;
+        u_off = 0;
+        break;
+    default:
+        y_off = 0;
+        u_off = 1;
+        break;
+    }
+
+    for (y=0; y<h; y++) {
+        u32 sy = (mode==VFLIP_HORIZ) ? y : (h-1-y);
+        u8 *dl = dst + y*wiB;
+        u8 *sl = src + sy*(wiB+8);
+        //lumas, sample x is at index 2*x+y_off
+        for (x=0; x<w; x++) {
+            u32 sx = (mode==VFLIP_VERT) ? x : (w-1-x);
+            assert_equal(memcmp(dl + (2*x+y_off)*bps, sl + (2*sx+y_off)*bps, bps), 0);
+        }
+        //chromas, macro-pixel k holds its 2 chroma samples at u_off and u_off+2
+        for (k=0; k<w/2; k++) {
+            u32 sk = (mode==VFLIP_VERT) ? k : (w/2-1-k);
+            assert_equal(memcmp(dl + (4*k+u_off)*bps, sl + (4*sk+u_off)*bps, bps), 0);
+            assert_equal(memcmp(dl + (4*k+u_off+2)*bps, sl + (4*sk+u_off+2)*bps, bps), 0);
+        }
+    }
+    gf_free(src);
+    gf_free(dst);
+}
+
+unittest(vflip_packed_422)
+{
+    vflip_check_422(GF_PIXEL_YUYV, 8, 3, VFLIP_HORIZ);
+    vflip_check_422(GF_PIXEL_YVYU, 6, 2, VFLIP_BOTH);
+    vflip_check_422(GF_PIXEL_UYVY, 10, 3, VFLIP_HORIZ);
+    vflip_check_422(GF_PIXEL_VYUY, 4, 4, VFLIP_BOTH);
+    vflip_check_422(GF_PIXEL_UYVY, 4, 5, VFLIP_VERT);
+    vflip_check_422(GF_PIXEL_YUYV_10, 6, 2, VFLIP_HORIZ);
+    vflip_check_422(GF_PIXEL_UYVY_10, 8, 3, VFLIP_BOTH);
+}
@@ -253,20 +253,12 @@ static GF_Err vcrop_process(GF_Filter *filter)
 	if (ctx->packed_422) {
 		src = src_planes[0] + s_off_x * bps * 2 + ctx->src_stride[0] * s_off_y;
 		dst = dst_planes[0] + d_off_x * bps * 2 + ctx->dst_stride[0] * d_off_y;
-		for (i=0; i<copy_h; i++) {
-			memcpy(dst, src, bps * copy_w * 2);
-			src += ctx->src_stride[0];
-			dst += ctx->dst_stride[0];
-		}
+		gf_pixel_copy_plane(dst, ctx->dst_stride[0], src, ctx->src_stride[0], bps * copy_w * 2, copy_h);
 	} else {
 		//copy first plane
 		src = src_planes[0] + s_off_x * bps + ctx->src_stride[0] * s_off_y;
 		dst = dst_planes[0] + d_off_x * bps + ctx->dst_stride[0] * d_off_y;
-		for (i=0; i<copy_h; i++) {
-			memcpy(dst, src, bps * copy_w);
-			src += ctx->src_stride[0];
-			dst += ctx->dst_stride[0];
-		}
+		gf_pixel_copy_plane(dst, ctx->dst_stride[0], src, ctx->src_stride[0], bps * copy_w, copy_h);
 	}
 
 	//nv12/21
@@ -274,23 +266,15 @@ static GF_Err vcrop_process(GF_Filter *filter)
 		src = src_planes[1] + s_off_x * bps + ctx->src_stride[1] * s_off_y/2;
 		dst = dst_planes[1] + d_off_x * bps + ctx->dst_stride[1] * d_off_y/2;
 		//half vertical res (/2)
-		for (i=0; i<copy_h/2; i++) {
-			//half horizontal res (/2) but two chroma packed per pixel (*2)
-			memcpy(dst, src, bps * copy_w);
-			src += ctx->src_stride[1];
-			dst += ctx->dst_stride[1];
-		}
+		//half horizontal res (/2) but two chroma packed per pixel (*2)
+		gf_pixel_copy_plane(dst, ctx->dst_stride[1], src, ctx->src_stride[1], bps * copy_w, copy_h/2);
 	} else if ((ctx->nb_planes==3) || (ctx->nb_planes==4)) {
 		u32 div_x, div_y;
 		//alpha/depth/other plane, treat as luma plane
 		if (ctx->nb_planes==4) {
 			src = src_planes[3] + s_off_x * bps + ctx->src_stride[3] * s_off_y;
 			dst = dst_planes[3] + d_off_x * bps + ctx->dst_stride[3] * d_off_y;
-			for (i=0; i<copy_h; i++) {
-				memcpy(dst, src, bps * copy_w);
-				src += ctx->src_stride[3];
-				dst += ctx->dst_stride[3];
-			}
+			gf_pixel_copy_plane(dst, ctx->dst_stride[3], src, ctx->src_stride[3], bps * copy_w, copy_h);
 		}
 
 		div_x = (ctx->src_stride[1]==ctx->src_stride[0]) ? 1 : 2;
@@ -301,19 +285,11 @@ static GF_Err vcrop_process(GF_Filter *filter)
 		copy_h /= div_y;
 		copy_w /= div_x;
 
-		for (i=0; i<copy_h; i++) {
-			memcpy(dst, src, bps * copy_w);
-			src += ctx->src_stride[1];
-			dst += ctx->dst_stride[1];
-		}
+		gf_pixel_copy_plane(dst, ctx->dst_stride[1], src, ctx->src_stride[1], bps * copy_w, copy_h);
 
 		src = src_planes[2] + s_off_x * bps / div_x + ctx->src_stride[2] * s_off_y / div_y;
 		dst = dst_planes[2] + d_off_x * bps / div_x + ctx->dst_stride[2] * d_off_y / div_y;
-		for (i=0; i<copy_h; i++) {
-			memcpy(dst, src, bps * copy_w);
-			src += ctx->src_stride[1];
-			dst += ctx->dst_stride[1];
-		}
+		gf_pixel_copy_plane(dst, ctx->dst_stride[1], src, ctx->src_stride[1], bps * copy_w, copy_h);
 	}
 
 	gf_filter_pck_send(dst_pck);
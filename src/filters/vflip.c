@@ -51,10 +51,6 @@ typedef struct
 	Bool use_reference;
 	Bool packed_422;
 
-
-	char *line_buffer_vf; //vertical flip
-	char *line_buffer_hf; //horizontal flip
-
 } GF_VFlipCtx;
 
 enum
@@ -67,145 +63,120 @@ enum
 
 
 
-static void swap_2Ys_YUVpixel(GF_VFlipCtx *ctx, u8 *line_src, u8 *line_dst, u32 FourBytes_start_index)
+//reverses nb_el elements of el_size bytes from src line into dst line, src and dst must not overlap
+static void horizontal_flip_line(u8 *dst, const u8 *src, u32 nb_el, u32 el_size)
 {
-	u32 isFirstY_indexOne;
-	switch (ctx->s_pfmt) {
-	case GF_PIXEL_YUYV:
-	case GF_PIXEL_YVYU:
-		isFirstY_indexOne= (u32) 0;
+	u32 j;
+	switch (el_size) {
+	case 1:
+		for (j=0; j<nb_el; j++)
+			dst[j] = src[nb_el-1-j];
 		break;
-	case GF_PIXEL_UYVY:
-	case GF_PIXEL_VYUY:
-		isFirstY_indexOne= (u32) 1;
+	case 2:
+		for (j=0; j<nb_el; j++)
+			((u16 *)dst)[j] = ((const u16 *)src)[nb_el-1-j];
+		break;
+	case 3:
+		src += 3*(nb_el-1);
+		for (j=0; j<nb_el; j++) {
+			dst[0] = src[0];
+			dst[1] = src[1];
+			dst[2] = src[2];
+			dst += 3;
+			src -= 3;
+		}
+		break;
+	case 4:
+		for (j=0; j<nb_el; j++)
+			((u32 *)dst)[j] = ((const u32 *)src)[nb_el-1-j];
+		break;
+	case 8:
+		for (j=0; j<nb_el; j++)
+			((u64 *)dst)[j] = ((const u64 *)src)[nb_el-1-j];
 		break;
 	default:
-		return;
+		for (j=0; j<nb_el; j++)
+			memcpy(dst + j*el_size, src + (nb_el-1-j)*el_size, el_size);
+		break;
 	}
-
-	//Y2_dst = Y1_src
-	line_dst[FourBytes_start_index + 2 + isFirstY_indexOne]=line_src[FourBytes_start_index + 0 + isFirstY_indexOne];
-
-	//Y1_dst = Y2_src
-	line_dst[FourBytes_start_index + 0 + isFirstY_indexOne]=line_src[FourBytes_start_index + 2 + isFirstY_indexOne];
 }
 
-static void horizontal_flip_per_line(GF_VFlipCtx *ctx, u8 *line_src, u8 *line_dst, u32 plane_idx, u32 wiB)
+//packed YUV 422: reverse macro-pixels (2 lumas, 2 chromas) and swap the two lumas of each macro-pixel
+static void horizontal_flip_line_422(GF_VFlipCtx *ctx, u8 *dst, const u8 *src, u32 nb_mp)
 {
-	u32 j, line_size = wiB;
-
-	if (ctx->s_pfmt == GF_PIXEL_RGB || ctx->s_pfmt == GF_PIXEL_BGR || ctx->s_pfmt == GF_PIXEL_XRGB || ctx->s_pfmt == GF_PIXEL_RGBX || ctx->s_pfmt == GF_PIXEL_XBGR || ctx->s_pfmt == GF_PIXEL_BGRX){
-		//to avoid "3*j > line_size - 3*j - 3" or "4*j > line_size - 4*j - 4"
-		//jmax=line_size/(2*3) or jmax=line_size/(2*4)
-		for (j=0; j < line_size/(2*ctx->bps); j++) {
-			u8 pix[4];
-			memcpy(pix, line_src + line_size - ctx->bps*(j+1), ctx->bps);
-			memcpy(line_dst + line_size - ctx->bps*(j+1), line_src + ctx->bps*j, ctx->bps);
-			memcpy(line_dst + ctx->bps*j, pix, ctx->bps);
-		}
-	} else if (ctx->packed_422) {
-		//If the source data is assigned to the output packet during the destination pack allocation
-		//i.e dst_planes[0]= src_planes[0], line_src is going to change while reading it as far as writing on line_dst=line_src
-		//To avoid this situation, ctx->line_buffer_hf keeps the values of line_src
-		memcpy(ctx->line_buffer_hf, line_src, wiB);
-
-		//reversing of 4-bytes sequences
-		u32 fourBytesSize = wiB/4;
-		for (j=0; j < fourBytesSize; j++) {
-			//buffer = last 4 columns
-			u32 last_4bytes_index = wiB-4-(4*j);
-			u32 p, first_4bytes_index = 4*j;
-			for (p = 0; p < 4; p++) {
-				line_dst[first_4bytes_index+p] = ctx->line_buffer_hf[last_4bytes_index+p];
-			}
-			//exchanging of Ys within a yuv pixel
-			swap_2Ys_YUVpixel(ctx, line_dst, line_dst, first_4bytes_index);
+	u32 j, y0, y1;
+	switch (ctx->s_pfmt) {
+	case GF_PIXEL_UYVY:
+	case GF_PIXEL_VYUY:
+	case GF_PIXEL_UYVY_10:
+	case GF_PIXEL_VYUY_10:
+		y0 = 1;
+		break;
+	default:
+		y0 = 0;
+		break;
+	}
+	y1 = y0 + 2;
+
+	if (ctx->bps==1) {
+		src += 4*(nb_mp-1);
+		for (j=0; j<nb_mp; j++) {
+			dst[y0] = src[y1];
+			dst[y0+1] = src[y0+1];
+			dst[y1] = src[y0];
+			dst[(y1+1)%4] = src[(y1+1)%4];
+			dst += 4;
+			src -= 4;
 		}
 	} else {
-		//nv12/21
-		//second plane is U-plane={u1,v1, u2,v2...}
-		if (ctx->nb_planes==2 && plane_idx==1){
-			if (ctx->bps==1) {
-				//to avoid "line_size - 2*j - 2 > 2*j", jmax=line_size/4
-				for (j=0; j < line_size/4; j++) {
-					u8 u_comp, v_comp;
-					u_comp = line_src[line_size - 2*j - 2];
-					v_comp = line_src[line_size - 2*j - 1];
-
-					line_dst[line_size - 2*j - 2] = line_src[2*j];
-					line_dst[line_size - 2*j - 1] = line_src[2*j + 1];
-
-					line_dst[2*j] = u_comp;
-					line_dst[2*j + 1] = v_comp;
-				}
-			} else {
-				for (j=0; j < line_size/4; j++) {
-					u16 u_comp, v_comp;
-					u_comp = line_src[line_size - 2*j - 2];
-					v_comp = line_src[line_size - 2*j - 1];
-
-					((u16 *)line_dst)[line_size - 2*j - 2] = ((u16 *)line_src)[2*j];
-					((u16 *)line_dst)[line_size - 2*j - 1] = ((u16 *)line_src)[2*j + 1];
-
-					((u16 *)line_dst)[2*j] = u_comp;
-					((u16 *)line_dst)[2*j + 1] = v_comp;
-				}
-			}
-		} else if (ctx->bps==1) {
-			u32 wx = line_size/2;
-			u8 tmp;
-			for (j=0; j < wx; j++) {
-				//tmp = last column
-				tmp = line_src[line_size-1-j];
-
-				//last column = first column
-				line_dst[line_size-1-j] = line_src[j];
-
-				//first column = tmp
-				line_dst[j]=tmp;
-			}
-		} else {
-			line_size /= 2;
-			u32 wx = line_size/2;
-			u16 tmp;
-			for (j=0; j < wx; j++) {
-				//tmp = last column
-				tmp = (u16) ( ((u16 *)line_src) [line_size-1-j] );
-
-				//last column = first column
-				((u16 *)line_dst) [line_size-1-j] = ((u16*)line_src)[j];
-
-				//first column = tmp
-				((u16 *)line_dst) [j]=tmp;
-			}
+		const u16 *src16 = ((const u16 *) src) + 4*(nb_mp-1);
+		u16 *dst16 = (u16 *) dst;
+		for (j=0; j<nb_mp; j++) {
+			dst16[y0] = src16[y1];
+			dst16[y0+1] = src16[y0+1];
+			dst16[y1] = src16[y0];
+			dst16[(y1+1)%4] = src16[(y1+1)%4];
+			dst16 += 4;
+			src16 -= 4;
 		}
 	}
 }
 
-static void horizontal_flip(GF_VFlipCtx *ctx, u8 *src_plane, u8 *dst_plane, u32 height, u32 plane_idx, u32 wiB, u32 *src_stride)
+static void flip_plane(GF_VFlipCtx *ctx, const u8 *src_plane, u8 *dst_plane, u32 height, u32 plane_idx, u32 wiB)
 {
-	u32 i;
-	for (i=0; i<height; i++) {
-		u8 *src_first_line = src_plane + i * src_stride[plane_idx];
-		u8 *dst_first_line = dst_plane + i * ctx->dst_stride[plane_idx];
+	u32 i, el_size;
+	u32 src_stride = ctx->src_stride[plane_idx];
+	u32 dst_stride = ctx->dst_stride[plane_idx];
+
+	if (!src_plane || !dst_plane || !height || !wiB) return;
 
-		horizontal_flip_per_line(ctx, src_first_line, dst_first_line, plane_idx, wiB);
+	//mode updated to off while configured
+	if (ctx->mode==VFLIP_OFF) {
+		gf_pixel_copy_plane(dst_plane, dst_stride, src_plane, src_stride, wiB, height);
+		return;
+	}
+	if (ctx->mode==VFLIP_VERT) {
+		for (i=0; i<height; i++) {
+			memcpy(dst_plane + (height - 1 - i) * dst_stride, src_plane + i*src_stride, wiB);
+		}
+		return;
 	}
-}
 
-static void vertical_flip(GF_VFlipCtx *ctx, u8 *src_plane, u8 *dst_plane, u32 height, u32 plane_idx, u32 wiB){
-	u32 hy, i;
-	hy = height/2;
-	for (i=0; i<hy; i++) {
-		u8 *src_first_line = src_plane+ i*ctx->src_stride[plane_idx];
-		u8 *src_last_line  = src_plane+ (height  - 1 - i) * ctx->src_stride[plane_idx];
+	//nv12/21 second plane is {u1,v1, u2,v2...}
+	if (ctx->nb_planes==2 && plane_idx==1)
+		el_size = 2*ctx->bps;
+	else
+		el_size = ctx->bps;
+	if (!el_size) return;
 
-		u8 *dst_first_line = dst_plane+ i*ctx->dst_stride[plane_idx];
-		u8 *dst_last_line  = dst_plane+ (height  - 1 - i) * ctx->dst_stride[plane_idx];
+	for (i=0; i<height; i++) {
+		const u8 *src_line = src_plane + i*src_stride;
+		u8 *dst_line = dst_plane + ((ctx->mode==VFLIP_BOTH) ? (height - 1 - i) : i) * dst_stride;
 
-		memcpy(ctx->line_buffer_vf, src_last_line, wiB);
-		memcpy(dst_last_line, src_first_line, wiB);
-		memcpy(dst_first_line, ctx->line_buffer_vf, wiB);
+		if (ctx->packed_422)
+			horizontal_flip_line_422(ctx, dst_line, src_line, wiB / (4*ctx->bps));
+		else
+			horizontal_flip_line(dst_line, src_line, wiB / el_size, el_size);
 	}
 }
 
@@ -270,14 +241,10 @@ static GF_Err vflip_process(GF_Filter *filter)
 	ctx->bps = gf_pixel_get_bytes_per_pixel(ctx->s_pfmt);
 
 
-	if (frame_ifce){
-		dst_pck = gf_filter_pck_new_alloc(ctx->opid, ctx->out_size, &output);
-		if (dst_pck)
-			gf_filter_pck_merge_properties(pck, dst_pck);
-	} else {
-		dst_pck = gf_filter_pck_new_clone(ctx->opid, pck, &output);
-	}
+	//all modes write every output byte from the source, no need to clone the input
+	dst_pck = gf_filter_pck_new_alloc(ctx->opid, ctx->out_size, &output);
 	if (!dst_pck) return GF_OUT_OF_MEM;
+	gf_filter_pck_merge_properties(pck, dst_pck);
 
 	dst_planes[0] = output;
 	if (ctx->nb_planes==1) {
@@ -326,15 +293,7 @@ static GF_Err vflip_process(GF_Filter *filter)
 			}
 		}
 
-		//processing according selected mode
-		if (ctx->mode==VFLIP_VERT){
-			vertical_flip(ctx, src_planes[i], dst_planes[i], height, i, wiB);
-		}else if (ctx->mode==VFLIP_HORIZ){
-			horizontal_flip(ctx, src_planes[i], dst_planes[i], height, i, wiB, ctx->src_stride);
-		}else if (ctx->mode==VFLIP_BOTH){
-			vertical_flip(ctx, src_planes[i], dst_planes[i], height, i, wiB);
-			horizontal_flip(ctx, dst_planes[i], dst_planes[i], height, i, wiB, ctx->dst_stride);
-		}
+		flip_plane(ctx, src_planes[i], dst_planes[i], height, i, wiB);
 	}
 
 	gf_filter_pck_send(dst_pck);
@@ -433,9 +392,6 @@ static GF_Err vflip_configure_pid(GF_Filter *filter, GF_FilterPid *pid, Bool is_
 
 		GF_LOG(GF_LOG_INFO, GF_LOG_MEDIA, ("[VFlip] Configured output full frame size %dx%d\n", ctx->w, ctx->h));
 
-		ctx->line_buffer_vf = gf_realloc(ctx->line_buffer_vf, sizeof(char)*ctx->dst_stride[0] );
-		ctx->line_buffer_hf = gf_realloc(ctx->line_buffer_hf, sizeof(char)*ctx->src_stride[0] );
-
 		ctx->packed_422 = GF_FALSE;
 		switch (pfmt) {
 		//for YUV 422, adjust to multiple of 2 on horizontal dim
@@ -443,6 +399,10 @@ static GF_Err vflip_configure_pid(GF_Filter *filter, GF_FilterPid *pid, Bool is_
 		case GF_PIXEL_YVYU:
 		case GF_PIXEL_UYVY:
 		case GF_PIXEL_VYUY:
+		case GF_PIXEL_YUYV_10:
+		case GF_PIXEL_YVYU_10:
+		case GF_PIXEL_UYVY_10:
+		case GF_PIXEL_VYUY_10:
 			ctx->packed_422 = GF_TRUE;
 			break;
 		}
@@ -462,14 +422,6 @@ static GF_Err vflip_configure_pid(GF_Filter *filter, GF_FilterPid *pid, Bool is_
 	return GF_OK;
 }
 
-void vflip_finalize(GF_Filter *filter)
-{
-	GF_VFlipCtx *ctx = gf_filter_get_udta(filter);
-	if (ctx->line_buffer_vf) gf_free(ctx->line_buffer_vf);
-	if (ctx->line_buffer_hf) gf_free(ctx->line_buffer_hf);
-}
-
-
 #define OFFS(_n)	#_n, offsetof(GF_VFlipCtx, _n)
 static GF_FilterArgs VFlipArgs[] =
 {
@@ -498,7 +450,6 @@ GF_FilterRegister VFlipRegister = {
 		.configure_pid = vflip_configure_pid,
 		SETCAPS(VFlipCaps),
 		.process = vflip_process,
-		.finalize = vflip_finalize,
 };
 
 
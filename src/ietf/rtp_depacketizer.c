@@ -602,17 +602,33 @@ static void gf_rtp_parse_ttxt(GF_RTPDepacketizer *rtp, GF_RTPHeader *hdr, u8 *pa
 	gf_bs_del(bs);
 }
 
+/*starts gathering a fragmented NAL, reusing the buffer of the previous one so that allocation settles to the largest NAL size*/
+static void gf_rtp_nal_frag_start(GF_RTPDepacketizer *rtp)
+{
+	rtp->inter_bs = gf_bs_new(rtp->frag_buf, rtp->frag_alloc, GF_BITSTREAM_WRITE_DYN);
+	if (!rtp->inter_bs) return;
+	rtp->frag_buf = NULL;
+	rtp->frag_alloc = 0;
+}
+
+/*ends gathering a fragmented NAL, the returned data is owned by the depacketizer*/
+static u8 *gf_rtp_nal_frag_end(GF_RTPDepacketizer *rtp, u32 *data_size)
+{
+	*data_size = 0;
+	gf_bs_get_content_no_truncate(rtp->inter_bs, &rtp->frag_buf, data_size, &rtp->frag_alloc);
+	gf_bs_del(rtp->inter_bs);
+	rtp->inter_bs = NULL;
+	return rtp->frag_buf;
+}
+
 static void gf_rtp_h264_flush(GF_RTPDepacketizer *rtp, GF_RTPHeader *hdr, Bool missed_end)
 {
 	u8 *data;
 	u32 data_size, nal_s;
 	if (!rtp->inter_bs) return;
 
-	data = NULL;
-	data_size = 0;
-	gf_bs_get_content(rtp->inter_bs, &data, &data_size);
-	gf_bs_del(rtp->inter_bs);
-	rtp->inter_bs = NULL;
+	data = gf_rtp_nal_frag_end(rtp, &data_size);
+	if (!data || (data_size<4)) return;
 	nal_s = data_size-4;
 
 	if (rtp->flags & GF_RTP_AVC_USE_ANNEX_B) {
@@ -635,7 +651,6 @@ static void gf_rtp_h264_flush(GF_RTPDepacketizer *rtp, GF_RTPHeader *hdr, Bool m
 	rtp->on_sl_packet(rtp->udta, data, data_size, &rtp->sl_hdr, GF_OK);
 	rtp->sl_hdr.accessUnitStartFlag = 0;
 	rtp->sl_hdr.randomAccessPointFlag = 0;
-	gf_free(data);
 }
 
 void gf_rtp_parse_h264(GF_RTPDepacketizer *rtp, GF_RTPHeader *hdr, u8 *payload, u32 size)
@@ -742,7 +757,8 @@ void gf_rtp_parse_h264(GF_RTPDepacketizer *rtp, GF_RTPHeader *hdr, u8 *payload,
 		/*setup*/
 		if (!rtp->inter_bs) {
 			u8 nal_hdr;
-			rtp->inter_bs = gf_bs_new(NULL, 0, GF_BITSTREAM_WRITE);
+			gf_rtp_nal_frag_start(rtp);
+			if (!rtp->inter_bs) return;
 			/*copy F and NRI*/
 			nal_hdr = payload[0] & 0xE0;
 			/*start bit not set, signal corrupted data (we missed start packet)*/
@@ -766,11 +782,8 @@ static void gf_rtp_hevc_vvc_flush(GF_RTPDepacketizer *rtp, GF_RTPHeader *hdr, Bo
 	u32 data_size, nal_s;
 	if (!rtp->inter_bs) return;
 
-	data = NULL;
-	data_size = 0;
-	gf_bs_get_content(rtp->inter_bs, &data, &data_size);
-	gf_bs_del(rtp->inter_bs);
-	rtp->inter_bs = NULL;
+	data = gf_rtp_nal_frag_end(rtp, &data_size);
+	if (!data || (data_size<5)) return;
 	nal_s = data_size-4;
 
 	data[0] = nal_s>>24;
@@ -787,7 +800,6 @@ static void gf_rtp_hevc_vvc_flush(GF_RTPDepacketizer *rtp, GF_RTPHeader *hdr, Bo
 	rtp->on_sl_packet(rtp->udta, data, data_size, &rtp->sl_hdr, GF_OK);
 	rtp->sl_hdr.accessUnitStartFlag = 0;
 	rtp->sl_hdr.randomAccessPointFlag = 0;
-	gf_free(data);
 }
 #endif
 
@@ -881,7 +893,8 @@ static void gf_rtp_parse_hevc(GF_RTPDepacketizer *rtp, GF_RTPHeader *hdr, u8 *pa
 		/*setup*/
 		if (!rtp->inter_bs) {
 			char nal_hdr[2];
-			rtp->inter_bs = gf_bs_new(NULL, 0, GF_BITSTREAM_WRITE);
+			gf_rtp_nal_frag_start(rtp);
+			if (!rtp->inter_bs) return;
 			/*coypy F bit highest bit of LayerId*/
 			nal_hdr[0] = payload[0] & 0x81;
 			/*assign NAL type*/
@@ -992,7 +1005,8 @@ static void gf_rtp_parse_vvc(GF_RTPDepacketizer *rtp, GF_RTPHeader *hdr, u8 *pay
 		/*setup*/
 		if (!rtp->inter_bs) {
 			char nal_hdr[2];
-			rtp->inter_bs = gf_bs_new(NULL, 0, GF_BITSTREAM_WRITE);
+			gf_rtp_nal_frag_start(rtp);
+			if (!rtp->inter_bs) return;
 			/*copy nal header*/
 			nal_hdr[0] = payload[0];
 			/*assign NAL type*/
@@ -2017,6 +2031,7 @@ void gf_rtp_depacketizer_del(GF_RTPDepacketizer *rtp)
 {
 	if (rtp) {
 		gf_rtp_depacketizer_reset(rtp, GF_FALSE);
+		if (rtp->frag_buf) gf_free(rtp->frag_buf);
 		if (rtp->sl_map.config) gf_free(rtp->sl_map.config);
 		if (rtp->key) gf_free(rtp->key);
 		gf_free(rtp);
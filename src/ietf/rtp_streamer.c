@@ -52,6 +52,14 @@ struct __rtp_streamer
 
 	const char *netcap_id;
 	GF_Err last_err;
+
+	/*streamers receiving the packets built by this streamer, NULL if none*/
+	GF_List *mirrors;
+	/*source streamer if this is a mirror*/
+	struct __rtp_streamer *mirror_src;
+	/*timestamp offset applied to the source packets if this is a mirror*/
+	u32 mirror_ts_offset;
+	Bool muted;
 };
 
 
@@ -61,10 +69,35 @@ static void rtp_stream_on_new_packet(void *cbk, GF_RTPHeader *header)
 {
 }
 
+static void rtp_stream_send_mirrors(GF_RTPStreamer *rtp, GF_RTPHeader *header)
+{
+	u32 i, count = gf_list_count(rtp->mirrors);
+	GF_RTPHeader hdr = *header;
+
+	/*the packet header is rewritten in place for each mirror, payload is shared*/
+	for (i=0; i<count; i++) {
+		GF_Err e;
+		GF_RTPStreamer *mirror = gf_list_get(rtp->mirrors, i);
+		if (!mirror->channel || mirror->muted) continue;
+
+		mirror->packetizer->rtp_header.SequenceNumber += 1;
+		hdr.SequenceNumber = mirror->packetizer->rtp_header.SequenceNumber;
+		hdr.TimeStamp = header->TimeStamp + mirror->mirror_ts_offset;
+		e = gf_rtp_send_packet(mirror->channel, &hdr, rtp->buffer+12, rtp->payload_len, GF_TRUE);
+		if (e) {
+			mirror->last_err = e;
+			GF_LOG(GF_LOG_WARNING, GF_LOG_RTP, ("[RTP] Error %s sending mirrored RTP packet SN %u - TS %u\n", gf_error_to_string(e), hdr.SequenceNumber, hdr.TimeStamp));
+		}
+	}
+}
+
 static void rtp_stream_on_packet_done(void *cbk, GF_RTPHeader *header)
 {
 	GF_RTPStreamer *rtp = (GF_RTPStreamer*)cbk;
-	GF_Err e = gf_rtp_send_packet(rtp->channel, header, rtp->buffer+12, rtp->payload_len, GF_TRUE);
+	GF_Err e = GF_OK;
+
+	if (!rtp->muted)
+		e = gf_rtp_send_packet(rtp->channel, header, rtp->buffer+12, rtp->payload_len, GF_TRUE);
 
 #ifndef GPAC_DISABLE_LOG
 	if (e) {
@@ -78,6 +111,9 @@ static void rtp_stream_on_packet_done(void *cbk, GF_RTPHeader *header)
 		fprintf(stderr, "Error %s sending RTP packet SN %u - TS %u\n", gf_error_to_string(e), header->SequenceNumber, header->TimeStamp);
 	}
 #endif
+	if (rtp->mirrors)
+		rtp_stream_send_mirrors(rtp, header);
+
 	rtp->payload_len = 0;
 }
 
@@ -558,6 +594,12 @@ GF_EXPORT
 void gf_rtp_streamer_del(GF_RTPStreamer *streamer)
 {
 	if (streamer) {
+		gf_rtp_streamer_remove_mirror(streamer);
+		while (gf_list_count(streamer->mirrors)) {
+			GF_RTPStreamer *mirror = gf_list_pop_back(streamer->mirrors);
+			mirror->mirror_src = NULL;
+		}
+		gf_list_del(streamer->mirrors);
 		if (streamer->channel) gf_rtp_del(streamer->channel);
 		if (streamer->packetizer) gf_rtp_builder_del(streamer->packetizer);
 		if (streamer->buffer) gf_free(streamer->buffer);
@@ -882,6 +924,7 @@ void gf_rtp_streamer_disable_auto_rtcp(GF_RTPStreamer *streamer)
 GF_EXPORT
 GF_Err gf_rtp_streamer_send_rtcp(GF_RTPStreamer *streamer, Bool force_ts, u32 rtp_ts, u32 force_ntp_type, u32 ntp_sec, u32 ntp_frac)
 {
+	if (!streamer->channel || streamer->muted) return GF_OK;
 	if (force_ts) streamer->channel->last_pck_ts = rtp_ts;
 	if (force_ntp_type) {
 		streamer->channel->forced_ntp_sec = ntp_sec;
@@ -910,7 +953,7 @@ GF_Err gf_rtp_streamer_send_rtcp(GF_RTPStreamer *streamer, Bool force_ts, u32 rt
 GF_EXPORT
 GF_Err gf_rtp_streamer_send_bye(GF_RTPStreamer *streamer)
 {
-	if (!streamer->channel) return GF_OK;
+	if (!streamer->channel || streamer->muted) return GF_OK;
 	return gf_rtp_send_bye(streamer->channel);
 }
 
@@ -977,5 +1020,36 @@ u32 gf_rtp_streamer_get_timescale(GF_RTPStreamer *streamer)
 	return (streamer && streamer->packetizer) ? streamer->packetizer->sl_config.timestampResolution : 0;
 }
 
+GF_EXPORT
+GF_Err gf_rtp_streamer_add_mirror(GF_RTPStreamer *streamer, GF_RTPStreamer *mirror, u32 ts_offset)
+{
+	if (!streamer || !mirror || (streamer==mirror)) return GF_BAD_PARAM;
+	if (streamer->packetizer->PayloadType != mirror->packetizer->PayloadType) return GF_BAD_PARAM;
+
+	gf_rtp_streamer_remove_mirror(mirror);
+	if (!streamer->mirrors) {
+		streamer->mirrors = gf_list_new();
+		if (!streamer->mirrors) return GF_OUT_OF_MEM;
+	}
+	mirror->mirror_src = streamer;
+	mirror->mirror_ts_offset = ts_offset;
+	mirror->last_err = GF_OK;
+	return gf_list_add(streamer->mirrors, mirror);
+}
+
+GF_EXPORT
+void gf_rtp_streamer_remove_mirror(GF_RTPStreamer *mirror)
+{
+	if (!mirror || !mirror->mirror_src) return;
+	gf_list_del_item(mirror->mirror_src->mirrors, mirror);
+	mirror->mirror_src = NULL;
+}
+
+GF_EXPORT
+void gf_rtp_streamer_mute(GF_RTPStreamer *streamer, Bool mute)
+{
+	if (streamer) streamer->muted = mute;
+}
+
 #endif /*GPAC_DISABLE_STREAMING && GPAC_DISABLE_ISOM*/
 
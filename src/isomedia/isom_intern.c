@@ -1133,6 +1133,10 @@ void gf_isom_delete_movie(GF_ISOFile *mov)
 #endif
 	if (mov->last_producer_ref_time)
 		gf_isom_box_del((GF_Box *) mov->last_producer_ref_time);
+#ifndef GPAC_DISABLE_ISOM_WRITE
+	if (mov->gz_comp) gf_gz_compressor_del(mov->gz_comp);
+	if (mov->comp_buf) gf_free(mov->comp_buf);
+#endif
 	if (mov->fileName) gf_free(mov->fileName);
 	gf_free(mov);
 }
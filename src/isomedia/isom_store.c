@@ -361,6 +361,19 @@ static GF_Err ShiftOffset(GF_ISOFile *file, GF_List *writers, u64 offset)
 
 #define COMP_BOX_COST_BYTES		8
 
+#ifndef GPAC_DISABLE_ZLIB
+//compress with the file compressor, created at first use
+static GF_Err isom_compress_data(GF_ISOFile *mov, u8 *data, u32 size, u8 **out_data, u32 *out_size)
+{
+	if (!mov->gz_comp) {
+		s32 level = mov->compress_level_plus_one ? (s32) mov->compress_level_plus_one - 1 : 9;
+		mov->gz_comp = gf_gz_compressor_new(level, mov->compress_strategy);
+		if (!mov->gz_comp) return GF_OUT_OF_MEM;
+	}
+	return gf_gz_compressor_process(mov->gz_comp, data, size, out_data, out_size);
+}
+#endif
+
 GF_Err gf_isom_write_compressed_box(GF_ISOFile *mov, GF_Box *root_box, u32 repl_type, GF_BitStream *bs, u32 *box_csize)
 {
 #ifdef GPAC_DISABLE_ZLIB
@@ -368,24 +381,28 @@ GF_Err gf_isom_write_compressed_box(GF_ISOFile *mov, GF_Box *root_box, u32 repl_
 #else
 	GF_Err e;
 	Bool use_cmov=GF_FALSE;
-	GF_BitStream *comp_bs = gf_bs_new(NULL, 0, GF_BITSTREAM_WRITE);
+	u8 *box_data, *comp_data;
+	u32 box_size, comp_size, offset;
+	//serialize in our reusable buffer
+	GF_BitStream *comp_bs = gf_bs_new(mov->comp_buf, mov->comp_buf_alloc, GF_BITSTREAM_WRITE_DYN);
+	if (!comp_bs) return GF_OUT_OF_MEM;
 	e = gf_isom_box_write(root_box, comp_bs);
+	gf_bs_get_content_no_truncate(comp_bs, &mov->comp_buf, &box_size, &mov->comp_buf_alloc);
+	gf_bs_del(comp_bs);
+	if (e) return e;
 
-	if (e) {
-		gf_bs_del(comp_bs);
-		return e;
-	}
 	if ((root_box->type==GF_ISOM_BOX_TYPE_MOOV) && mov->brand && (mov->brand->majorBrand == GF_ISOM_BRAND_QT)) {
 		use_cmov = GF_TRUE;
 	}
-	u8 *box_data;
-	u32 box_size, comp_size;
 
 	if (box_csize)
 		*box_csize = (u32) root_box->size;
 
-	gf_bs_get_content(comp_bs, &box_data, &box_size);
-	gf_gz_compress_payload_ex(&box_data, box_size, &comp_size, use_cmov ? 0 : 8, GF_FALSE, NULL, GF_FALSE);
+	box_data = mov->comp_buf;
+	offset = use_cmov ? 0 : 8;
+	e = isom_compress_data(mov, box_data + offset, box_size - offset, &comp_data, &comp_size);
+	if (e) return e;
+
 	if ((mov->compress_flags & GF_ISOM_COMP_FORCE_ALL) || (comp_size + COMP_BOX_COST_BYTES < box_size)) {
 		if (bs) {
 			if (use_cmov) {
@@ -399,7 +416,7 @@ GF_Err gf_isom_write_compressed_box(GF_ISOFile *mov, GF_Box *root_box, u32 repl_
 				gf_bs_write_u32(bs, comp_size+12);
 				gf_bs_write_u32(bs, GF_QT_BOX_TYPE_CMVD);
 				gf_bs_write_u32(bs, (u32) root_box->size);
-				gf_bs_write_data(bs, box_data, comp_size);
+				gf_bs_write_data(bs, comp_data, comp_size);
 
 				gf_bs_write_u32(bs, 8+mov->pad_cmov);
 				gf_bs_write_u32(bs, GF_ISOM_BOX_TYPE_FREE);
@@ -411,7 +428,7 @@ GF_Err gf_isom_write_compressed_box(GF_ISOFile *mov, GF_Box *root_box, u32 repl_
 			} else {
 				gf_bs_write_u32(bs, comp_size+8);
 				gf_bs_write_u32(bs, repl_type);
-				gf_bs_write_data(bs, box_data, comp_size);
+				gf_bs_write_data(bs, comp_data, comp_size);
 			}
 		}
 		if (box_csize) {
@@ -422,12 +439,9 @@ GF_Err gf_isom_write_compressed_box(GF_ISOFile *mov, GF_Box *root_box, u32 repl_
 			}
 		}
 	} else if (bs) {
-		gf_isom_box_write(root_box, bs);
+		gf_bs_write_data(bs, box_data, box_size);
 	}
-	gf_free(box_data);
-
-	gf_bs_del(comp_bs);
-	return e;
+	return GF_OK;
 #endif /*GPAC_DISABLE_ZLIB*/
 }
 
@@ -569,7 +583,14 @@ u64 GetMoovAndMetaSize(GF_ISOFile *movie, GF_List *writers)
 		}
 
 		gf_bs_get_content(bs, &box_data, &box_size);
-		gf_gz_compress_payload_ex(&box_data, box_size, &osize, 0, GF_FALSE, NULL, GF_FALSE);
+#ifndef GPAC_DISABLE_ZLIB
+		u8 *comp_data;
+		//use the file compressor so that the size matches the final compressed moov
+		if (isom_compress_data(movie, box_data, box_size, &comp_data, &osize) != GF_OK)
+			osize = box_size;
+#else
+		osize = box_size;
+#endif
 		gf_free(box_data);
 		gf_bs_del(bs);
 		return osize + 8 + 8 + 12 + 12;
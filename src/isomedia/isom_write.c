@@ -2587,6 +2587,16 @@ GF_Err gf_isom_enable_compression(GF_ISOFile *file, GF_ISOCompressMode compress_
 	return GF_OK;
 }
 
+GF_EXPORT
+GF_Err gf_isom_set_compression_level(GF_ISOFile *file, u32 level, u32 strategy)
+{
+	if (!file || (level>9)) return GF_BAD_PARAM;
+	if (file->gz_comp) return GF_BAD_PARAM;
+	file->compress_level_plus_one = level+1;
+	file->compress_strategy = strategy;
+	return GF_OK;
+}
+
 GF_EXPORT
 GF_Err gf_isom_force_64bit_chunk_offset(GF_ISOFile *file, Bool set_on)
 {
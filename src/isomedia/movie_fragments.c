@@ -2382,6 +2382,8 @@ GF_Err gf_isom_flush_sidx(GF_ISOFile *movie, u32 sidx_max_size, Bool force_v1)
 	GF_BitStream *bs;
 	GF_Err e;
 	u32 size;
+	u8 *ssix_data=NULL;
+	u32 ssix_size=0;
 	//and only at setup
 	if (!movie || !(movie->FragmentsFlags & GF_ISOM_FRAG_WRITE_READY) ) return GF_BAD_PARAM;
 	if (movie->openMode != GF_ISOM_OPEN_WRITE) return GF_ISOM_INVALID_MODE;
@@ -2445,11 +2447,12 @@ GF_Err gf_isom_flush_sidx(GF_ISOFile *movie, u32 sidx_max_size, Bool force_v1)
 			gf_isom_box_size((GF_Box *) movie->root_ssix);
 
 			if (movie->compress_mode>=GF_ISOM_COMP_MOOF_SSIX) {
-				u32 ssix_comp_size;
-				//compute ssix compressed size by using NULL destination bitstream
-				//not really optimum since we compress twice the ssix, to optimize ...
-				e = gf_isom_write_compressed_box(movie, (GF_Box *) movie->root_ssix, GF_4CC('!', 's', 's', 'x'), NULL, &ssix_comp_size);
-				movie->root_sidx->first_offset = ssix_comp_size;
+				//compress ssix once, we need its size before writing the sidx
+				GF_BitStream *ssix_bs = gf_bs_new(NULL, 0, GF_BITSTREAM_WRITE);
+				e = gf_isom_write_compressed_box(movie, (GF_Box *) movie->root_ssix, GF_4CC('!', 's', 's', 'x'), ssix_bs, NULL);
+				gf_bs_get_content(ssix_bs, &ssix_data, &ssix_size);
+				gf_bs_del(ssix_bs);
+				movie->root_sidx->first_offset = ssix_size;
 			} else {
 				movie->root_sidx->first_offset = (u32) movie->root_ssix->size;
 			}
@@ -2463,14 +2466,15 @@ GF_Err gf_isom_flush_sidx(GF_ISOFile *movie, u32 sidx_max_size, Bool force_v1)
 		}
 
 		if (!e && movie->root_ssix) {
-			if (movie->compress_mode>=GF_ISOM_COMP_MOOF_SSIX) {
-				e = gf_isom_write_compressed_box(movie, (GF_Box *) movie->root_ssix, GF_4CC('!', 's', 's', 'x'), bs, NULL);
+			if (ssix_data) {
+				gf_bs_write_data(bs, ssix_data, ssix_size);
 			} else {
 				e = gf_isom_box_write((GF_Box *) movie->root_ssix, bs);
 			}
 		}
 	}
 
+	if (ssix_data) gf_free(ssix_data);
 	gf_isom_box_del((GF_Box*) movie->root_sidx);
 	movie->root_sidx = NULL;
 	if (movie->root_ssix) {
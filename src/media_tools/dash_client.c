@@ -891,28 +891,15 @@ setup_multicast_clock:
 								is_valid = GF_FALSE;
 							} else if (seg_timeline) {
 								number -= pto;
-								u64 start_time=number;
-								u32 ti, nb_it = gf_list_count(seg_timeline->entries);
-								Bool et_found=GF_FALSE;;
-								number = startNum;
-								for (ti=0; ti<nb_it; ti++) {
-									u32 seg_i;
-									GF_MPD_SegmentTimelineEntry *te = gf_list_get(seg_timeline->entries, ti);
-									u64 seg_start = te->start_time;
-									for (seg_i=0; seg_i<te->repeat_count+1;seg_i++) {
-										//we need an exact match
-										if (seg_start == start_time) {
-											timeline_offset_ms = start_time;
-											et_found=GF_TRUE;
-											break;
-										}
-										seg_start+=te->duration;
-										number++;
-									}
-									if (et_found) break;
-								}
-								if (!et_found)
+								u64 start_time=number, seg_start;
+								u32 seg_idx = gf_mpd_segment_timeline_find_segment(seg_timeline, start_time, &seg_start);
+								//we need an exact match
+								if ((seg_start == start_time) && (gf_mpd_segment_timeline_get_segment(seg_timeline, seg_idx, &seg_start, NULL)==GF_OK)) {
+									timeline_offset_ms = start_time;
+									number = startNum + seg_idx;
+								} else {
 									is_valid=GF_FALSE;
+								}
 							} else if (segdur) {
 								number -= pto;
 								number = startNum + number / segdur;
@@ -1927,6 +1914,19 @@ static u32 gf_dash_get_index_in_timeline(GF_MPD_SegmentTimeline *timeline, u64 s
 	u64 start_time = 0;
 	u32 idx = 0;
 	u32 i, count, repeat;
+
+	if (start_timescale==timescale) {
+		idx = gf_mpd_segment_timeline_find_segment(timeline, segment_start, &start_time);
+		if (start_time == segment_start)
+			return idx;
+		if (gf_mpd_segment_timeline_get_segment(timeline, idx, &start_time, NULL) == GF_OK) {
+			GF_LOG(GF_LOG_INFO, GF_LOG_DASH, ("[DASH] Warning: segment timeline entry start "LLU" greater than segment start "LLU", using current entry\n", start_time, segment_start));
+			return idx;
+		}
+		GF_LOG(GF_LOG_ERROR, GF_LOG_DASH, ("[DASH] Error: could not find previous segment start in current timeline ! seeking to end of timeline\n"));
+		return idx;
+	}
+
 	count = gf_list_count(timeline->entries);
 	for (i=0; i<count; i++) {
 		GF_MPD_SegmentTimelineEntry *ent = gf_list_get(timeline->entries, i);
@@ -2854,6 +2854,22 @@ process_m3u8_manifest:
 						else
 							hls_temp_rep->segment_list->xlink_href = gf_strdup(rep->segment_list->previous_xlink_href);
 
+						//locate the most recent full segment before the live edge, as done when merging segments below
+						//entries up to this segment are already in our list and will not be loaded from the refreshed playlist
+						if (dash->is_m3u8 && rep->segment_list->segment_URLs) {
+							for (j=gf_list_count(rep->segment_list->segment_URLs); j>0; j--) {
+								GF_MPD_SegmentURL *old_seg = gf_list_get(rep->segment_list->segment_URLs, j-1);
+								if (old_seg->hls_ll_chunk_type || !old_seg->media) continue;
+								if (group->llhls_edge_chunk && (group->llhls_edge_chunk->hls_seq_num <= old_seg->hls_seq_num)) continue;
+
+								hls_temp_rep->m3u8_known_url = gf_strdup(old_seg->media);
+								if (old_seg->media_range) {
+									hls_temp_rep->m3u8_known_start_range = old_seg->media_range->start_range;
+									hls_temp_rep->m3u8_known_end_range = old_seg->media_range->end_range;
+								}
+								break;
+							}
+						}
 						new_rep = hls_temp_rep;
 					}
 				}
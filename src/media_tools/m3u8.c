@@ -890,6 +890,8 @@ GF_Err gf_m3u8_parse_master_playlist(const char *file, MasterPlaylist **playlist
 	return gf_m3u8_parse_sub_playlist(file, playlist, baseURL, NULL, NULL, GF_TRUE);
 }
 
+static void reset_line_attribs(s_accumulated_attributes *attribs);
+
 GF_Err declare_sub_playlist(char *currentLine, const char *baseURL, s_accumulated_attributes *attribs, PlaylistElement *sub_playlist, MasterPlaylist **playlist, Stream *in_stream)
 {
 	u32 i, count;
@@ -1051,6 +1053,12 @@ GF_Err declare_sub_playlist(char *currentLine, const char *baseURL, s_accumulate
 		if (attribs->is_playlist_ended)
 			curr_playlist->element.playlist.is_ended = GF_TRUE;
 	}
+	reset_line_attribs(attribs);
+	return GF_OK;
+}
+
+static void reset_line_attribs(s_accumulated_attributes *attribs)
+{
 	/* Cleanup all line-specific fields */
 	if (attribs->title) {
 		gf_free(attribs->title);
@@ -1082,7 +1090,6 @@ GF_Err declare_sub_playlist(char *currentLine, const char *baseURL, s_accumulate
 		gf_free(attribs->group.video);
 		attribs->group.video = NULL;
 	}
-	return GF_OK;
 }
 
 typedef struct
@@ -1093,6 +1100,32 @@ typedef struct
 	Double duration;
 } HLS_LLChunk;
 
+/*segments and parts of a media playlist already known from a previous parse*/
+typedef struct
+{
+	u32 nb_segments, nb_parts;
+	Double duration;
+	u64 utc;
+	Bool has_first;
+	char *init_url;
+} HLS_KnownEntries;
+
+static void skip_known_entry(s_accumulated_attributes *attribs, HLS_KnownEntries *known)
+{
+	//the variant init segment is the one of the first entry
+	if (!known->has_first) {
+		known->has_first = GF_TRUE;
+		known->init_url = attribs->init_url ? gf_strdup(attribs->init_url) : NULL;
+	}
+	known->duration += attribs->duration_in_seconds;
+	//same UTC propagation as when converting the playlist to a segment list
+	if (attribs->playlist_utc_timestamp)
+		known->utc = attribs->playlist_utc_timestamp;
+	if (known->utc)
+		known->utc += (u32) (attribs->duration_in_seconds*1000);
+	reset_line_attribs(attribs);
+}
+
 static void reset_attribs(s_accumulated_attributes *attribs, Bool is_cleanup)
 {
 	attribs->width = attribs->height = 0;
@@ -1111,7 +1144,7 @@ static void reset_attribs(s_accumulated_attributes *attribs, Bool is_cleanup)
 }
 
 
-GF_Err gf_m3u8_parse_sub_playlist(const char *m3u8_file, MasterPlaylist **playlist, const char *baseURL, Stream *in_stream, PlaylistElement *sub_playlist, Bool is_master)
+static GF_Err m3u8_parse_playlist(const char *m3u8_file, MasterPlaylist **playlist, const char *baseURL, Stream *in_stream, PlaylistElement *sub_playlist, Bool is_master, const char *known_url, u64 known_start_range, u64 known_end_range)
 {
 	int i, currentLineNumber;
 	FILE *f = NULL;
@@ -1121,6 +1154,13 @@ GF_Err gf_m3u8_parse_sub_playlist(const char *m3u8_file, MasterPlaylist **playli
 	char **attributes = NULL;
 	Bool release_blob = GF_FALSE;
 	s_accumulated_attributes attribs;
+	HLS_KnownEntries known;
+	u32 nb_loaded = 0;
+	u64 parse_start = gf_sys_clock_high_res();
+	//entries are skipped until the known segment is found, only possible on a new playlist
+	Bool skip_known = (known_url && (*playlist == NULL)) ? GF_TRUE : GF_FALSE;
+
+	memset(&known, 0, sizeof(HLS_KnownEntries));
 
 	if (!strncmp(m3u8_file, "gmem://", 7)) {
 		GF_Err e = gf_blob_get(m3u8_file, &m3u8_payload,  &m3u8_size, NULL);
@@ -1141,6 +1181,7 @@ GF_Err gf_m3u8_parse_sub_playlist(const char *m3u8_file, MasterPlaylist **playli
 
 #define _CLEANUP \
 	reset_attribs(&attribs, GF_TRUE);\
+	if (known.init_url) gf_free(known.init_url);\
 	if (f) gf_fclose(f); \
 	else if (release_blob) gf_blob_release(m3u8_file);
 
@@ -1237,7 +1278,14 @@ GF_Err gf_m3u8_parse_sub_playlist(const char *m3u8_file, MasterPlaylist **playli
 
 					attribs.low_latency = GF_TRUE;
 					attribs.is_media_segment = GF_TRUE;
-					e = declare_sub_playlist(file, baseURL, &attribs, sub_playlist, playlist, in_stream);
+					if (skip_known) {
+						skip_known_entry(&attribs, &known);
+						known.nb_parts++;
+						e = GF_OK;
+					} else {
+						e = declare_sub_playlist(file, baseURL, &attribs, sub_playlist, playlist, in_stream);
+						nb_loaded++;
+					}
 
 					(*playlist)->low_latency = GF_TRUE;
 					sep[0] = '"';
@@ -1295,6 +1343,32 @@ GF_Err gf_m3u8_parse_sub_playlist(const char *m3u8_file, MasterPlaylist **playli
 			/*file encountered: sub-playlist or segment*/
 			GF_Err e;
 			const char *pl_url = baseURL;
+
+			if (attribs.is_master_playlist)
+				skip_known = GF_FALSE;
+
+			if (skip_known) {
+				//not the known segment, only track its sequence number, duration and UTC
+				if (strcmp(currentLine, known_url)
+					|| (attribs.byte_range_start != known_start_range)
+					|| (attribs.byte_range_end != known_end_range)
+				) {
+					skip_known_entry(&attribs, &known);
+					known.nb_segments++;
+					attribs.current_media_seq += 1;
+					reset_attribs(&attribs, GF_FALSE);
+					continue;
+				}
+				//known segment found, load it and all following entries as if previous ones had been declared
+				skip_known = GF_FALSE;
+				if (known.has_first) {
+					if (attribs.init_url) gf_free(attribs.init_url);
+					attribs.init_url = known.init_url;
+					known.init_url = NULL;
+					if (!attribs.playlist_utc_timestamp)
+						attribs.playlist_utc_timestamp = known.utc;
+				}
+			}
 			//this is the first (master) playlist but what is parsed is not a master playlist
 			//we will create a master + child with xlink, but the xlink must be only the file name
 			//otherwise dir/pl_video.m3u8 will be translated in master(dir/pl_video.m3u8) [ child(xlink=dir/pl_video.m3u8) ]
@@ -1303,6 +1377,7 @@ GF_Err gf_m3u8_parse_sub_playlist(const char *m3u8_file, MasterPlaylist **playli
 				pl_url = gf_file_basename(baseURL);
 			e = declare_sub_playlist(currentLine, pl_url, &attribs, sub_playlist, playlist, in_stream);
 			attribs.current_media_seq += 1;
+			nb_loaded++;
 			if (e != GF_OK) {
 				_CLEANUP
 				return e;
@@ -1319,6 +1394,13 @@ GF_Err gf_m3u8_parse_sub_playlist(const char *m3u8_file, MasterPlaylist **playli
 
 #undef _CLEANUP
 
+	//known segment no longer in playlist, reload everything
+	if (skip_known && known.has_first) {
+		GF_LOG(GF_LOG_DEBUG, GF_LOG_DASH, ("[M3U8] Segment %s not found in playlist %s, reloading all entries\n", known_url, baseURL));
+		gf_m3u8_master_playlist_del(playlist);
+		return m3u8_parse_playlist(m3u8_file, playlist, baseURL, in_stream, sub_playlist, is_master, NULL, 0, 0);
+	}
+
 	for (i=0; i<(int)gf_list_count((*playlist)->streams); i++) {
 		u32 j;
 		Stream *prog = gf_list_get((*playlist)->streams, i);
@@ -1326,6 +1408,10 @@ GF_Err gf_m3u8_parse_sub_playlist(const char *m3u8_file, MasterPlaylist **playli
 		for (j=0; j<gf_list_count(prog->variants); j++) {
 			PlaylistElement *ple = gf_list_get(prog->variants, j);
 			if (ple->element_type == TYPE_PLAYLIST) {
+				if (known.has_first) {
+					ple->element.playlist.nb_skipped_segments = known.nb_segments;
+					ple->element.playlist.computed_duration += known.duration;
+				}
 				if (ple->element.playlist.computed_duration > prog->computed_duration)
 					prog->computed_duration = ple->element.playlist.computed_duration;
 			}
@@ -1336,5 +1422,16 @@ GF_Err gf_m3u8_parse_sub_playlist(const char *m3u8_file, MasterPlaylist **playli
 	if (attribs.version < attribs.compatibility_version) {
 		GF_LOG(GF_LOG_DEBUG, GF_LOG_DASH, ("[M3U8] Version %d specified but tags from version %d detected\n", attribs.version, attribs.compatibility_version));
 	}
+	GF_LOG(GF_LOG_DEBUG, GF_LOG_DASH, ("[M3U8] Parsed playlist %s in "LLU" us - %u entries loaded, %u segments and %u parts already known\n", baseURL, gf_sys_clock_high_res() - parse_start, nb_loaded, known.nb_segments, known.nb_parts));
 	return GF_OK;
 }
+
+GF_Err gf_m3u8_parse_sub_playlist(const char *m3u8_file, MasterPlaylist **playlist, const char *baseURL, Stream *in_stream, PlaylistElement *sub_playlist, Bool is_master)
+{
+	return m3u8_parse_playlist(m3u8_file, playlist, baseURL, in_stream, sub_playlist, is_master, NULL, 0, 0);
+}
+
+GF_Err gf_m3u8_parse_media_playlist_update(const char *m3u8_file, MasterPlaylist **playlist, const char *baseURL, const char *known_url, u64 known_start_range, u64 known_end_range)
+{
+	return m3u8_parse_playlist(m3u8_file, playlist, baseURL, NULL, NULL, GF_FALSE, known_url, known_start_range, known_end_range);
+}
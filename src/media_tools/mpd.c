@@ -1156,10 +1156,45 @@ void gf_mpd_segment_entry_free(void *_item)
 {
 	gf_free(_item);
 }
+typedef struct
+{
+	//start time of first segment of the entry
+	u64 start_time;
+	//cumulated duration of segments before the entry, ignoring gaps in the timeline
+	u64 dur_offset;
+	//index of first segment of the entry
+	u32 first_seg;
+	u32 nb_segs;
+	u32 duration;
+} GF_MPD_TimelineIndexEntry;
+
+/*compiled segment timeline, avoiding linear walks of the entry list for each segment lookup*/
+struct __mpd_timeline_index
+{
+	GF_MPD_TimelineIndexEntry *entries;
+	u32 nb_entries, nb_alloc;
+	u32 nb_segs;
+	u64 end_time, total_dur;
+	//set if each entry starts after the end of the previous one
+	Bool monotonic;
+
+	//state of the timeline at build time: live updates only append/modify the last entry and purge/modify the first one
+	GF_MPD_SegmentTimelineEntry *first, *last;
+	u64 first_start, last_start;
+	u32 first_dur, last_dur, first_repeat, last_repeat;
+};
+
+static void gf_mpd_timeline_index_del(struct __mpd_timeline_index *idx)
+{
+	if (idx->entries) gf_free(idx->entries);
+	gf_free(idx);
+}
+
 void gf_mpd_segment_timeline_free(void *_item)
 {
 	GF_MPD_SegmentTimeline *ptr = (GF_MPD_SegmentTimeline *)_item;
 	gf_mpd_del_list(ptr->entries, gf_mpd_segment_entry_free, 0);
+	if (ptr->index) gf_mpd_timeline_index_del(ptr->index);
 	gf_free(ptr);
 }
 
@@ -1278,6 +1313,7 @@ void gf_mpd_representation_free(void *_item)
 		gf_free(ptr->playback.init_segment.data);
 	}
 	if (ptr->playback.key_url) gf_free(ptr->playback.key_url);
+	if (ptr->m3u8_known_url) gf_free(ptr->m3u8_known_url);
 
 	gf_mpd_del_list(ptr->base_URLs, gf_mpd_base_url_free, 0);
 	gf_mpd_del_list(ptr->sub_representations, NULL/*TODO*/, 0);
@@ -2439,7 +2475,11 @@ GF_Err gf_m3u8_solve_representation_xlink(GF_MPD_Representation *rep, const char
 		return GF_EOS;
 	}
 
-	e = gf_m3u8_parse_sub_playlist(loc_file, &pl, rep->segment_list->xlink_href, NULL, NULL, GF_FALSE);
+	//playlist refresh, only load segments after the last known one
+	if (rep->m3u8_known_url)
+		e = gf_m3u8_parse_media_playlist_update(loc_file, &pl, rep->segment_list->xlink_href, rep->m3u8_known_url, rep->m3u8_known_start_range, rep->m3u8_known_end_range);
+	else
+		e = gf_m3u8_parse_sub_playlist(loc_file, &pl, rep->segment_list->xlink_href, NULL, NULL, GF_FALSE);
 	//no longer needed
 	gf_free(full_url);
 	if (e) {
@@ -2521,6 +2561,8 @@ GF_Err gf_m3u8_solve_representation_xlink(GF_MPD_Representation *rep, const char
 
 	seq_num = pe->element.playlist.media_seq_min;
 	seq_num += pe->element.playlist.discontinuity;
+	//segments already known were not loaded
+	seq_num += pe->element.playlist.nb_skipped_segments;
 
 	u64 seg_utc = 0;
 	for (k=0; k<count_elements; k++) {
@@ -3774,7 +3816,63 @@ static void hls_insert_crypt_info(FILE *out, GF_MPD_Representation *rep, GF_DASH
 	}
 }
 
-static GF_Err gf_mpd_write_m3u8_playlist(const GF_MPD *mpd, const GF_MPD_Period *period, const GF_MPD_AdaptationSet *as, GF_MPD_Representation *rep, char *m3u8_name, u32 hls_version, Double max_part_dur_session, const char *force_base_url)
+//build rendition report of each representation (in period enumeration order), shared by all variant playlists
+static char **gf_mpd_m3u8_get_rendition_reports(const GF_MPD_Period *period, u32 *nb_reports)
+{
+	u32 i_as=0, nb_reps=0, idx=0;
+	const GF_MPD_AdaptationSet *o_as;
+	char **reports;
+	while ( (o_as = gf_list_enum(period->adaptation_sets, &i_as))) {
+		nb_reps += gf_list_count(o_as->representations);
+	}
+	*nb_reports = 0;
+	if (!nb_reps) return NULL;
+	reports = gf_malloc(sizeof(char *) * nb_reps);
+	if (!reports) return NULL;
+	memset(reports, 0, sizeof(char *) * nb_reps);
+
+	i_as=0;
+	while ( (o_as = gf_list_enum(period->adaptation_sets, &i_as))) {
+		u32 i_rep=0;
+		GF_MPD_Representation *o_rep;
+		while ( (o_rep = gf_list_enum(o_as->representations, &i_rep))) {
+			char szRep[100];
+			GF_DASH_SegmentContext *o_sctx = gf_list_last(o_rep->state_seg_list);
+			idx++;
+			if (!o_sctx || !o_sctx->llhls_mode) continue;
+			//not clear in the spec, we assume what is listed must be the last PART completely produced
+			//if no frag and a segment exists before, use last part of that segment
+			if (!o_sctx->nb_frags) {
+				u32 nb_segs = gf_list_count(o_rep->state_seg_list);
+				if (nb_segs<2) continue;
+				o_sctx = gf_list_get(o_rep->state_seg_list, nb_segs-2);
+				if (!o_sctx || !o_sctx->nb_frags) continue;
+			}
+
+			char *o_name = (char *) o_rep->m3u8_name;
+			if (!o_name) {
+				o_name = gf_file_basename(o_rep->m3u8_var_name);
+			}
+			sprintf(szRep, "\",LAST-MSN=%d,LAST-PART=%d\n", o_sctx->seg_num, o_sctx->nb_frags);
+			gf_dynstrcat(&reports[idx-1], o_name, NULL);
+			gf_dynstrcat(&reports[idx-1], szRep, NULL);
+		}
+	}
+	*nb_reports = nb_reps;
+	return reports;
+}
+
+static void gf_mpd_m3u8_del_rendition_reports(char **reports, u32 nb_reports)
+{
+	u32 i;
+	if (!reports) return;
+	for (i=0; i<nb_reports; i++) {
+		if (reports[i]) gf_free(reports[i]);
+	}
+	gf_free(reports);
+}
+
+static GF_Err gf_mpd_write_m3u8_playlist(const GF_MPD *mpd, const GF_MPD_Period *period, const GF_MPD_AdaptationSet *as, GF_MPD_Representation *rep, char *m3u8_name, u32 hls_version, Double max_part_dur_session, const char *force_base_url, char **rend_reports, u32 nb_rend_reports)
 {
 	u32 i, count;
 	GF_DASH_SegmentContext *sctx;
@@ -3923,40 +4021,20 @@ static GF_Err gf_mpd_write_m3u8_playlist(const GF_MPD *mpd, const GF_MPD_Period
 					}
 				}
 				//generate rendition report
-				if (mpd->llhls_rendition_reports) {
-					char *par_dir= strchr(m3u8_name, '/');
-					u32 i_as=0;
+				if (mpd->llhls_rendition_reports && rend_reports) {
+					//we always produce from the same root, so just use ../
+					//if no parent dir we are producing at the root, and report name is relative to the root
+					Bool par_dir = strchr(m3u8_name, '/') ? GF_TRUE : GF_FALSE;
+					u32 i_as=0, idx=0;
 					const GF_MPD_AdaptationSet *o_as;
 					while ( (o_as = gf_list_enum(period->adaptation_sets, &i_as))) {
 						u32 i_rep=0;
 						GF_MPD_Representation *o_rep;
 						while ( (o_rep = gf_list_enum(o_as->representations, &i_rep))) {
-							GF_DASH_SegmentContext *o_sctx;
+							idx++;
 							if (o_rep == rep) continue;
-							o_sctx = gf_list_last(o_rep->state_seg_list);
-							if (!o_sctx || !o_sctx->llhls_mode) continue;
-							//not clear in the spec, we assume what is listed must be the last PART completely produced
-							//if no frag and a segment exists before, use last part of that segment
-							if (!o_sctx->nb_frags) {
-								u32 idx = gf_list_count(o_rep->state_seg_list);
-								if (idx<2) continue;
-								o_sctx = gf_list_get(o_rep->state_seg_list, idx-2);
-								if (!o_sctx || !o_sctx->nb_frags) continue;
-							}
-
-							char *o_name = (char *) o_rep->m3u8_name;
-							if (!o_name) {
-								o_name = gf_file_basename(o_rep->m3u8_var_name);
-							}
-							char *par_url = NULL;
-							//we always produce from the same root, so just use ../
-							//if no parent dir we are producing at the root, and o_name is relative to the root
-							if (par_dir) {
-								gf_dynstrcat(&par_url, "../", NULL);
-								gf_dynstrcat(&par_url, o_name, NULL);
-							}
-							fprintf(out, "#EXT-X-RENDITION-REPORT:URI=\"%s\",LAST-MSN=%d,LAST-PART=%d\n", par_url ? par_url : o_name, o_sctx->seg_num, o_sctx->nb_frags);
-							if (par_url) gf_free(par_url);
+							if ((idx>nb_rend_reports) || !rend_reports[idx-1]) continue;
+							gf_fprintf(out, "#EXT-X-RENDITION-REPORT:URI=\"%s%s", par_dir ? "../" : "", rend_reports[idx-1]);
 						}
 					}
 				}
@@ -4075,6 +4153,8 @@ GF_Err gf_mpd_write_m3u8_master_playlist(GF_MPD const * const mpd, FILE *out, co
 	Bool has_video = GF_FALSE;
 	Bool has_audio = GF_FALSE;
 	Bool has_cc = GF_FALSE;
+	char **rend_reports = NULL;
+	u32 nb_rend_reports = 0;
 
 	if (!m3u8_name || !period) return GF_BAD_PARAM;
 
@@ -4233,6 +4313,9 @@ GF_Err gf_mpd_write_m3u8_master_playlist(GF_MPD const * const mpd, FILE *out, co
 		}
 	}
 
+	if (mpd->llhls_rendition_reports && (mpd->type == GF_MPD_TYPE_DYNAMIC) && (mode!=GF_M3U8_WRITE_MASTER))
+		rend_reports = gf_mpd_m3u8_get_rendition_reports(period, &nb_rend_reports);
+
 	//second pass, generate all subplaylists
 	i=0;
 	while ( (as = (GF_MPD_AdaptationSet *) gf_list_enum(period->adaptation_sets, &i))) {
@@ -4250,13 +4333,15 @@ GF_Err gf_mpd_write_m3u8_master_playlist(GF_MPD const * const mpd, FILE *out, co
 			}
 
 			e = gf_mpd_write_m3u8_playlist(mpd, period, as, rep, name, hls_version, max_part_dur_session,
-				((mpd->hls_abs_url==1) || (mpd->hls_abs_url==3)) ? force_base_url : NULL);
+				((mpd->hls_abs_url==1) || (mpd->hls_abs_url==3)) ? force_base_url : NULL, rend_reports, nb_rend_reports);
 			if (e) {
 				GF_LOG(GF_LOG_ERROR, GF_LOG_DASH, ("[M3U8] IO error while opening m3u8 files\n"));
+				gf_mpd_m3u8_del_rendition_reports(rend_reports, nb_rend_reports);
 				return GF_IO_ERR;
 			}
 		}
 	}
+	gf_mpd_m3u8_del_rendition_reports(rend_reports, nb_rend_reports);
 
 	//no muxed comp, no video, the audio is the main media we will list, force nb_audio=0 for gf_mpd_write_m3u8_playlist_tags
 	if (!has_video && !has_muxed_comp)
@@ -4972,40 +5057,21 @@ GF_Err gf_mpd_resolve_url(GF_MPD *mpd, GF_MPD_Representation *rep, GF_MPD_Adapta
 				strcat(solved_template, "$Time$");
 			} else if (timeline) {
 				/*uses segment timeline*/
-				u32 k, nb_seg, cur_idx, nb_repeat;
-				u64 time, start_time;
-				nb_seg = gf_list_count(timeline->entries);
-				cur_idx = 0;
-				start_time=0;
-				for (k=0; k<nb_seg; k++) {
-					GF_MPD_SegmentTimelineEntry *ent = gf_list_get(timeline->entries, k);
-					if (item_index>cur_idx+ent->repeat_count) {
-						cur_idx += 1 + ent->repeat_count;
-						if (ent->start_time)
-							start_time = ent->start_time;
-						if (k<nb_seg-1) {
-							start_time +=  (u64) (ent->duration * (1 + ent->repeat_count));
-							continue;
-						} else {
-							gf_free(url);
-							gf_free(solved_template);
-							second_sep[0] = '$';
-							return GF_EOS;
-						}
-					}
-					*segment_duration_in_ms = ent->duration;
-					*segment_duration_in_ms = (u32) ((Double) (*segment_duration_in_ms) * 1000.0 / timescale);
-					nb_repeat = item_index - cur_idx;
-					time = ent->start_time ? ent->start_time : start_time;
-					time += nb_repeat * ent->duration;
-
-					/*replace final 'd' with LLD (%lld or I64d)*/
-					szPrintFormat[strlen(szPrintFormat)-1] = 0;
-					strcat(szPrintFormat, &LLU[1]);
-					sprintf(szFormat, szPrintFormat, time);
-					strcat(solved_template, szFormat);
-					break;
+				u64 time;
+				u32 seg_dur;
+				if (gf_mpd_segment_timeline_get_segment(timeline, item_index, &time, &seg_dur) != GF_OK) {
+					gf_free(url);
+					gf_free(solved_template);
+					second_sep[0] = '$';
+					return GF_EOS;
 				}
+				*segment_duration_in_ms = (u32) ((Double) seg_dur * 1000.0 / timescale);
+
+				/*replace final 'd' with LLD (%lld or I64d)*/
+				szPrintFormat[strlen(szPrintFormat)-1] = 0;
+				strcat(szPrintFormat, &LLU[1]);
+				sprintf(szFormat, szPrintFormat, time);
+				strcat(solved_template, szFormat);
 			} else if (duration) {
 				u64 time = item_index * duration + pto;
 				szPrintFormat[strlen(szPrintFormat)-1] = 0;
@@ -5126,31 +5192,176 @@ void gf_mpd_resolve_segment_duration(GF_MPD_Representation *rep, GF_MPD_Adaptati
 	}
 }
 
+static Bool gf_mpd_timeline_index_valid(struct __mpd_timeline_index *idx, GF_MPD_SegmentTimeline *timeline)
+{
+	GF_MPD_SegmentTimelineEntry *first, *last;
+	u32 count = gf_list_count(timeline->entries);
+	if (count != idx->nb_entries) return GF_FALSE;
+	if (!count) return GF_TRUE;
+	first = gf_list_get(timeline->entries, 0);
+	last = gf_list_last(timeline->entries);
+	if ((first != idx->first) || (first->start_time != idx->first_start) || (first->duration != idx->first_dur) || (first->repeat_count != idx->first_repeat))
+		return GF_FALSE;
+	if ((last != idx->last) || (last->start_time != idx->last_start) || (last->duration != idx->last_dur) || (last->repeat_count != idx->last_repeat))
+		return GF_FALSE;
+	return GF_TRUE;
+}
+
+static struct __mpd_timeline_index *gf_mpd_segment_timeline_get_index(GF_MPD_SegmentTimeline *timeline)
+{
+	u32 i, count;
+	u64 start_time;
+	struct __mpd_timeline_index *idx = timeline->index;
+
+	if (idx && gf_mpd_timeline_index_valid(idx, timeline))
+		return idx;
+
+	if (!idx) {
+		GF_SAFEALLOC(idx, struct __mpd_timeline_index);
+		if (!idx) return NULL;
+		timeline->index = idx;
+	}
+	count = gf_list_count(timeline->entries);
+	if (count > idx->nb_alloc) {
+		idx->entries = gf_realloc(idx->entries, sizeof(GF_MPD_TimelineIndexEntry) * count);
+		if (!idx->entries) {
+			idx->nb_alloc = 0;
+			gf_mpd_timeline_index_del(idx);
+			timeline->index = NULL;
+			return NULL;
+		}
+		idx->nb_alloc = count;
+	}
+	idx->nb_entries = count;
+	idx->nb_segs = 0;
+	idx->total_dur = 0;
+	idx->monotonic = GF_TRUE;
+	start_time = 0;
+	for (i=0; i<count; i++) {
+		GF_MPD_SegmentTimelineEntry *ent = gf_list_get(timeline->entries, i);
+		GF_MPD_TimelineIndexEntry *ie = &idx->entries[i];
+		u64 span;
+
+		if (ent->start_time) {
+			if (ent->start_time < start_time) idx->monotonic = GF_FALSE;
+			start_time = ent->start_time;
+		}
+		ie->start_time = start_time;
+		ie->dur_offset = idx->total_dur;
+		ie->first_seg = idx->nb_segs;
+		ie->nb_segs = ent->repeat_count + 1;
+		ie->duration = ent->duration;
+
+		span = (u64) ie->nb_segs * ent->duration;
+		start_time += span;
+		idx->total_dur += span;
+		if (idx->nb_segs + ie->nb_segs < idx->nb_segs) idx->nb_segs = 0xFFFFFFFF;
+		else idx->nb_segs += ie->nb_segs;
+	}
+	idx->end_time = start_time;
+
+	if (count) {
+		idx->first = gf_list_get(timeline->entries, 0);
+		idx->last = gf_list_last(timeline->entries);
+		idx->first_start = idx->first->start_time;
+		idx->first_dur = idx->first->duration;
+		idx->first_repeat = idx->first->repeat_count;
+		idx->last_start = idx->last->start_time;
+		idx->last_dur = idx->last->duration;
+		idx->last_repeat = idx->last->repeat_count;
+	} else {
+		idx->first = idx->last = NULL;
+	}
+	return idx;
+}
+
+GF_EXPORT
+GF_Err gf_mpd_segment_timeline_get_segment(GF_MPD_SegmentTimeline *timeline, u32 segment_index, u64 *out_start_time, u32 *out_duration)
+{
+	u32 low, high;
+	GF_MPD_TimelineIndexEntry *ie;
+	struct __mpd_timeline_index *idx;
+	if (!timeline || !out_start_time) return GF_BAD_PARAM;
+	idx = gf_mpd_segment_timeline_get_index(timeline);
+	if (!idx) return GF_OUT_OF_MEM;
+
+	if (segment_index >= idx->nb_segs) {
+		*out_start_time = idx->end_time;
+		return GF_EOS;
+	}
+	//last entry with first_seg <= segment_index, empty entries share first_seg with the next one
+	low = 0;
+	high = idx->nb_entries;
+	while (high - low > 1) {
+		u32 mid = (low + high) / 2;
+		if (idx->entries[mid].first_seg <= segment_index) low = mid;
+		else high = mid;
+	}
+	ie = &idx->entries[low];
+	*out_start_time = ie->start_time + (u64) (segment_index - ie->first_seg) * ie->duration;
+	if (out_duration) *out_duration = ie->duration;
+	return GF_OK;
+}
+
+//checks if a segment of the entry starts at or after time
+static Bool gf_mpd_timeline_entry_find(GF_MPD_TimelineIndexEntry *ie, u64 time, u32 *seg_in_entry)
+{
+	if (!ie->nb_segs) return GF_FALSE;
+	if (ie->start_time >= time) {
+		*seg_in_entry = 0;
+		return GF_TRUE;
+	}
+	if (ie->start_time + (u64) (ie->nb_segs - 1) * ie->duration < time)
+		return GF_FALSE;
+	*seg_in_entry = (u32) ((time - ie->start_time + ie->duration - 1) / ie->duration);
+	return GF_TRUE;
+}
+
+GF_EXPORT
+u32 gf_mpd_segment_timeline_find_segment(GF_MPD_SegmentTimeline *timeline, u64 time, u64 *out_start_time)
+{
+	u32 i, k;
+	struct __mpd_timeline_index *idx = timeline ? gf_mpd_segment_timeline_get_index(timeline) : NULL;
+	if (!idx) {
+		if (out_start_time) *out_start_time = 0;
+		return 0;
+	}
+
+	i = 0;
+	if (idx->monotonic && idx->nb_entries) {
+		//last entry starting at or before time
+		u32 low = 0, high = idx->nb_entries;
+		while (high - low > 1) {
+			u32 mid = (low + high) / 2;
+			if (idx->entries[mid].start_time <= time) low = mid;
+			else high = mid;
+		}
+		i = low;
+	}
+	for (; i<idx->nb_entries; i++) {
+		GF_MPD_TimelineIndexEntry *ie = &idx->entries[i];
+		if (!gf_mpd_timeline_entry_find(ie, time, &k)) continue;
+		if (out_start_time) *out_start_time = ie->start_time + (u64) k * ie->duration;
+		return ie->first_seg + k;
+	}
+	if (out_start_time) *out_start_time = idx->end_time;
+	return idx->nb_segs;
+}
+
 static u64 gf_mpd_segment_timeline_start(GF_MPD_SegmentTimeline *timeline, u32 segment_index, u64 *segment_duration)
 {
 	u64 start_time = 0;
-	u32 i, idx, k;
-	idx = 0;
-	for (i = 0; i<gf_list_count(timeline->entries); i++) {
-		GF_MPD_SegmentTimelineEntry *ent = gf_list_get(timeline->entries, i);
-		if (ent->start_time) start_time = ent->start_time;
-		for (k = 0; k<ent->repeat_count + 1; k++) {
-			if (idx == segment_index) {
-				if (segment_duration)
-					*segment_duration = ent->duration;
-				return start_time;
-			}
-			idx++;
-			start_time += ent->duration;
-		}
+	u32 dur;
+	if (gf_mpd_segment_timeline_get_segment(timeline, segment_index, &start_time, &dur) == GF_OK) {
+		if (segment_duration)
+			*segment_duration = dur;
 	}
 	return start_time;
 }
 
-GF_EXPORT
-GF_Err gf_mpd_get_segment_start_time_with_timescale(s32 in_segment_index,
+static GF_Err gf_mpd_get_segment_start_time_ex(s32 in_segment_index,
 	GF_MPD_Period const * const period, GF_MPD_AdaptationSet const * const set, GF_MPD_Representation const * const rep,
-	u64 *out_segment_start_time, u64 *out_opt_segment_duration, u32 *out_opt_scale)
+	u64 *out_segment_start_time, u64 *out_opt_segment_duration, u32 *out_opt_scale, GF_MPD_SegmentTimeline **out_timeline)
 {
 	u64 duration = 0, start_time = 0, pto = 0;
 	u32 timescale = 0;
@@ -5188,6 +5399,7 @@ GF_Err gf_mpd_get_segment_start_time_with_timescale(s32 in_segment_index,
 			if (gf_list_count(rep->segment_list->segment_URLs)) seglist = rep->segment_list->segment_URLs;
 		}
 		if (!timescale) timescale = 1;
+		if (out_timeline) *out_timeline = timeline;
 
 		if (timeline) {
 			start_time = gf_mpd_segment_timeline_start(timeline, in_segment_index, &duration);
@@ -5240,6 +5452,7 @@ GF_Err gf_mpd_get_segment_start_time_with_timescale(s32 in_segment_index,
 		if (rep->segment_template->presentation_time_offset) pto = rep->segment_template->presentation_time_offset;
 	}
 	if (!timescale) timescale = 1;
+	if (out_timeline) *out_timeline = timeline;
 
 	if (timeline) {
 		start_time = gf_mpd_segment_timeline_start(timeline, in_segment_index, &duration);
@@ -5256,6 +5469,56 @@ GF_Err gf_mpd_get_segment_start_time_with_timescale(s32 in_segment_index,
 	return GF_OK;
 }
 
+GF_EXPORT
+GF_Err gf_mpd_get_segment_start_time_with_timescale(s32 in_segment_index,
+	GF_MPD_Period const * const period, GF_MPD_AdaptationSet const * const set, GF_MPD_Representation const * const rep,
+	u64 *out_segment_start_time, u64 *out_opt_segment_duration, u32 *out_opt_scale)
+{
+	return gf_mpd_get_segment_start_time_ex(in_segment_index, period, set, rep, out_segment_start_time, out_opt_segment_duration, out_opt_scale, NULL);
+}
+
+/*seek in segment timeline using the compiled index: as for other segment descriptions, segment start is the cumulated duration of previous segments*/
+static void gf_mpd_seek_in_timeline(Double seek_time, MPDSeekMode seek_mode, GF_MPD_SegmentTimeline *timeline, u32 timescale, u32 *out_segment_index, Double *out_opt_seek_time)
+{
+	u32 low, high, k;
+	Double seg_start, seg_dur;
+	GF_MPD_TimelineIndexEntry *ie;
+	struct __mpd_timeline_index *idx = gf_mpd_segment_timeline_get_index(timeline);
+
+	if (!idx || !idx->nb_entries) {
+		*out_segment_index = 0;
+		if (out_opt_seek_time) *out_opt_seek_time = 0;
+		return;
+	}
+	//last entry with dur_offset <= seek time, empty entries share dur_offset with the next one
+	low = 0;
+	high = idx->nb_entries;
+	while (high - low > 1) {
+		u32 mid = (low + high) / 2;
+		if (idx->entries[mid].dur_offset <= seek_time * timescale) low = mid;
+		else high = mid;
+	}
+	ie = &idx->entries[low];
+	k = 0;
+	if (ie->duration && (seek_time * timescale > ie->dur_offset))
+		k = (u32) ((seek_time * timescale - ie->dur_offset) / ie->duration);
+
+	//beyond timeline end
+	if (!ie->duration || (k >= ie->nb_segs)) {
+		*out_segment_index = idx->nb_segs;
+		if (out_opt_seek_time) *out_opt_seek_time = ((Double) idx->total_dur) / timescale;
+		return;
+	}
+	seg_start = ((Double) (ie->dur_offset + (u64) k * ie->duration)) / timescale;
+	seg_dur = ((Double) ie->duration) / timescale;
+	*out_segment_index = ie->first_seg + k;
+	if ((seek_mode == MPD_SEEK_NEAREST) && (seg_start + seg_dur - seek_time < seek_time - seg_start)) {
+		(*out_segment_index)++;
+		seg_start += seg_dur;
+	}
+	if (out_opt_seek_time) *out_opt_seek_time = seg_start;
+}
+
 #if 0 //unused
 static GF_Err mpd_seek_periods(Double seek_time, GF_MPD const * const in_mpd, GF_MPD_Period **out_period)
 {
@@ -5302,6 +5565,24 @@ GF_Err gf_mpd_seek_in_period(Double seek_time, MPDSeekMode seek_mode,
 	if (!out_segment_index) {
 		return GF_BAD_PARAM;
 	}
+	if ((seek_mode != MPD_SEEK_PREV) && (seek_mode != MPD_SEEK_NEAREST)) {
+		gf_assert(0);
+		return GF_NOT_SUPPORTED;
+	}
+
+	/*segment timeline, use its index rather than iterating over segments*/
+	{
+		u64 start;
+		u32 timescale=1000;
+		GF_MPD_SegmentTimeline *timeline = NULL;
+		GF_Err e = gf_mpd_get_segment_start_time_ex(0, in_period, in_set, in_rep, &start, NULL, &timescale, &timeline);
+		if (e<0)
+			return e;
+		if (timeline) {
+			gf_mpd_seek_in_timeline(seek_time, seek_mode, timeline, timescale, out_segment_index, out_opt_seek_time);
+			return GF_OK;
+		}
+	}
 
 	while (1) {
 		Double segment_duration;
@@ -35,8 +35,10 @@
 #define GF_ROUTE_SOCK_SIZE	0x80000
 
 Bool gf_sk_has_nrt_netcap(GF_Socket *sk);
+Bool gf_sk_has_netcap(GF_Socket *sk);
 
 typedef struct __route_service GF_ROUTEService;
+typedef struct __route_worker GF_ROUTEWorker;
 
 typedef enum
 {
@@ -117,9 +119,11 @@ typedef struct {
 } GF_FLUTELLMapEntry;
 
 
-typedef struct
+typedef struct __lct_object
 {
 	u32 toi, tsi;
+	//next object in service TSI/TOI hash bucket
+	struct __lct_object *hash_next;
 	u32 total_length;
 	//fragment reaggregation
 	char *payload;
@@ -170,7 +174,10 @@ typedef enum
 	GF_ROUTE_TUNE_SLS_ONLY,
 } GF_ROUTETuneMode;
 
-typedef GF_Err (*gf_service_process)(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, GF_ROUTESession *route_sess);
+//number of buckets for TSI/TOI object lookup, must be a power of 2
+#define ROUTE_OBJ_HASH_SIZE	256
+
+typedef GF_Err (*gf_service_process)(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, GF_ROUTEWorker *w, u8 *data, u32 nb_read);
 struct __route_service
 {
 	u32 service_id;
@@ -180,6 +187,10 @@ struct __route_service
 	GF_Socket *sock;
 	u32 secondary_sockets;
 	GF_List *objects;
+	//objects indexed by TSI/TOI
+	GF_LCTObject *obj_hash[ROUTE_OBJ_HASH_SIZE];
+	//set once an object uses a low-latency chunk map, TOI lookup then needs a full scan
+	Bool has_ll_maps;
 	GF_LCTObject *last_active_obj;
 	u32 nb_media_streams;
 	//number of active session running on main socket
@@ -200,6 +211,51 @@ struct __route_service
 
 	char *service_identifier;
 	char *log_name;
+
+	//thread in charge of this service sockets and reassembly, NULL if not threaded
+	GF_ROUTEWorker *worker;
+	//packets left by the worker to the demuxer thread, protected by worker mx
+	GF_List *pending_pcks;
+	//object progressed and object completed by the worker, dispatched by the demuxer thread
+	GF_LCTObject *push_obj, *done_obj;
+};
+
+//UDP packet received by a worker thread
+typedef struct
+{
+	u8 *data;
+	u32 size;
+	u64 recv_time;
+} GF_ROUTEPacket;
+
+//socket registered in a worker, with its owning service
+typedef struct
+{
+	GF_Socket *sock;
+	GF_ROUTEService *s;
+} GF_ROUTEWorkerSocket;
+
+//maximum number of packets pending per service before a worker stops reading the service sockets
+#define ROUTE_MAX_PENDING_PCKS	4096
+
+struct __route_worker
+{
+	GF_ROUTEDmx *routedmx;
+	GF_Thread *th;
+	Bool run;
+	//protects sockets and socks, held while polling
+	GF_Mutex *sk_mx;
+	GF_SockGroup *sockets;
+	GF_List *socks;
+	//protects pending packets, packet reservoir and counters, held while the worker processes a packet
+	GF_Mutex *mx;
+	GF_List *pck_res;
+	//when set, the demuxer thread uses services state and all packets are left pending
+	u32 paused;
+	GF_BitStream *bs;
+	//packets processed by the worker since last demuxer call
+	u32 nb_processed;
+	u64 nb_packets, nb_bytes, first_pck_time, last_pck_time;
 };
 
 //maximum segs we keep in cache when playing from pcap in no realtime: this accounts for
@@ -248,10 +304,14 @@ struct __gf_routedmx {
     GF_Mutex *blob_mx;
 
 	Bool dvb_mabr;
+
+	//worker threads, services are assigned in round-robin at creation
+	GF_ROUTEWorker **workers;
+	u32 nb_workers, next_worker;
 };
 
-static GF_Err dmx_process_service_route(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, GF_ROUTESession *route_sess);
-static GF_Err dmx_process_service_dvb_flute(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, GF_ROUTESession *route_sess);
+static GF_Err dmx_process_service_route(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, GF_ROUTEWorker *w, u8 *data, u32 nb_read);
+static GF_Err dmx_process_service_dvb_flute(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, GF_ROUTEWorker *w, u8 *data, u32 nb_read);
 
 
 static void gf_route_static_files_del(GF_List *files)
@@ -264,10 +324,123 @@ static void gf_route_static_files_del(GF_List *files)
 	gf_list_del(files);
 }
 
-static void gf_route_route_session_del(GF_ROUTEDmx *routedmx, GF_ROUTESession *rs)
+static void gf_route_sock_register(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, GF_Socket *sock)
+{
+	GF_ROUTEWorker *w = s->worker;
+	if (!sock) return;
+	if (!w) {
+		gf_sk_group_register(routedmx->active_sockets, sock);
+		return;
+	}
+	gf_mx_p(w->sk_mx);
+	u32 i, count = gf_list_count(w->socks);
+	for (i=0; i<count; i++) {
+		GF_ROUTEWorkerSocket *ws = gf_list_get(w->socks, i);
+		if (ws->sock == sock) break;
+	}
+	if (i==count) {
+		GF_ROUTEWorkerSocket *ws;
+		GF_SAFEALLOC(ws, GF_ROUTEWorkerSocket);
+		if (ws) {
+			ws->sock = sock;
+			ws->s = s;
+			gf_list_add(w->socks, ws);
+			//workers drain sockets after each poll
+			gf_sk_set_block_mode(sock, GF_TRUE);
+			gf_sk_group_register(w->sockets, sock);
+		}
+	}
+	gf_mx_v(w->sk_mx);
+}
+
+//once this returns, the worker no longer uses the socket and it can be destroyed
+static void gf_route_sock_unregister(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, GF_Socket *sock)
+{
+	GF_ROUTEWorker *w = s->worker;
+	if (!sock) return;
+	if (!w) {
+		gf_sk_group_unregister(routedmx->active_sockets, sock);
+		return;
+	}
+	gf_mx_p(w->sk_mx);
+	u32 i, count = gf_list_count(w->socks);
+	for (i=0; i<count; i++) {
+		GF_ROUTEWorkerSocket *ws = gf_list_get(w->socks, i);
+		if (ws->sock != sock) continue;
+		gf_list_rem(w->socks, i);
+		gf_free(ws);
+		gf_sk_group_unregister(w->sockets, sock);
+		break;
+	}
+	gf_mx_v(w->sk_mx);
+}
+
+//move all pending packets of the service back to the worker reservoir
+static void gf_route_service_flush_packets(GF_ROUTEService *s)
+{
+	GF_ROUTEWorker *w = s->worker;
+	if (!w || !s->pending_pcks) return;
+	gf_mx_p(w->mx);
+	while (gf_list_count(s->pending_pcks)) {
+		gf_list_add(w->pck_res, gf_list_pop_back(s->pending_pcks));
+	}
+	gf_mx_v(w->mx);
+}
+
+static void gf_route_dmx_update_stats(GF_ROUTEDmx *routedmx, u32 nb_read, u64 recv_time)
+{
+	routedmx->nb_packets++;
+	routedmx->total_bytes_recv += nb_read;
+	routedmx->last_pck_time = recv_time;
+	if (!routedmx->first_pck_time) routedmx->first_pck_time = recv_time;
+}
+
+/*workers process packets of their services as long as the demuxer thread does not use the services state.
+While paused, workers keep receiving but leave all packets to the demuxer thread. Pausing waits for the packet being processed by each worker.
+This must be called around any access to services and objects from outside the workers, calls can be nested*/
+static void gf_route_dmx_pause_workers(GF_ROUTEDmx *routedmx, Bool do_pause)
+{
+	u32 i;
+	for (i=0; i<routedmx->nb_workers; i++) {
+		GF_ROUTEWorker *w = routedmx->workers[i];
+		gf_mx_p(w->mx);
+		if (do_pause) w->paused++;
+		else if (w->paused) w->paused--;
+		gf_mx_v(w->mx);
+	}
+}
+
+static void gf_route_worker_del(GF_ROUTEWorker *w)
+{
+	if (w->th) {
+		w->run = GF_FALSE;
+		gf_th_del(w->th);
+	}
+	if (w->pck_res) {
+		while (gf_list_count(w->pck_res)) {
+			GF_ROUTEPacket *pck = gf_list_pop_back(w->pck_res);
+			gf_free(pck->data);
+			gf_free(pck);
+		}
+		gf_list_del(w->pck_res);
+	}
+	if (w->socks) {
+		while (gf_list_count(w->socks)) {
+			gf_free(gf_list_pop_back(w->socks));
+		}
+		gf_list_del(w->socks);
+	}
+	if (w->sockets) gf_sk_group_del(w->sockets);
+	if (w->sk_mx) gf_mx_del(w->sk_mx);
+	if (w->mx) gf_mx_del(w->mx);
+	if (w->bs) gf_bs_del(w->bs);
+	gf_free(w);
+}
+
+static void gf_route_route_session_del(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, GF_ROUTESession *rs)
 {
 	if (rs->sock) {
-		gf_sk_group_unregister(routedmx->active_sockets, rs->sock);
+		gf_route_sock_unregister(routedmx, s, rs->sock);
 		gf_sk_del(rs->sock);
 	}
 	while (gf_list_count(rs->channels)) {
@@ -295,10 +468,63 @@ static void gf_route_lct_obj_del(GF_LCTObject *o)
 	gf_free(o);
 }
 
+static GF_LCTObject **gf_route_service_obj_bucket(GF_ROUTEService *s, u32 tsi, u32 toi)
+{
+	return &s->obj_hash[(toi + tsi*31) & (ROUTE_OBJ_HASH_SIZE-1)];
+}
+
+static GF_LCTObject *gf_route_service_find_object(GF_ROUTEService *s, u32 tsi, u32 toi)
+{
+	GF_LCTObject *obj = *gf_route_service_obj_bucket(s, tsi, toi);
+	while (obj) {
+		if ((obj->toi==toi) && (obj->tsi==tsi)) return obj;
+		obj = obj->hash_next;
+	}
+	return NULL;
+}
+
+static void gf_route_service_unhash_object(GF_ROUTEService *s, GF_LCTObject *obj)
+{
+	GF_LCTObject **prev = gf_route_service_obj_bucket(s, obj->tsi, obj->toi);
+	while (*prev) {
+		if (*prev == obj) {
+			*prev = obj->hash_next;
+			break;
+		}
+		prev = &(*prev)->hash_next;
+	}
+	obj->hash_next = NULL;
+}
+
+//adds object to service, objects are appended to their bucket so that lookup matches the first object in list order
+static void gf_route_service_add_object(GF_ROUTEService *s, GF_LCTObject *obj)
+{
+	GF_LCTObject **prev = gf_route_service_obj_bucket(s, obj->tsi, obj->toi);
+	while (*prev) {
+		//already registered
+		if (*prev == obj) return;
+		prev = &(*prev)->hash_next;
+	}
+	*prev = obj;
+	obj->hash_next = NULL;
+	gf_list_add(s->objects, obj);
+}
+
+static void gf_route_service_set_object_toi(GF_ROUTEService *s, GF_LCTObject *obj, u32 toi)
+{
+	if (obj->toi == toi) return;
+	gf_route_service_unhash_object(s, obj);
+	obj->toi = toi;
+	//append to new bucket
+	GF_LCTObject **prev = gf_route_service_obj_bucket(s, obj->tsi, obj->toi);
+	while (*prev) prev = &(*prev)->hash_next;
+	*prev = obj;
+}
+
 static void gf_route_service_del(GF_ROUTEDmx *routedmx, GF_ROUTEService *s)
 {
 	if (s->sock) {
-		gf_sk_group_unregister(routedmx->active_sockets, s->sock);
+		gf_route_sock_unregister(routedmx, s, s->sock);
 		gf_sk_del(s->sock);
 	}
 	while (gf_list_count(s->objects)) {
@@ -309,10 +535,15 @@ static void gf_route_service_del(GF_ROUTEDmx *routedmx, GF_ROUTEService *s)
 
 	while (gf_list_count(s->route_sessions)) {
 		GF_ROUTESession *rsess = gf_list_pop_back(s->route_sessions);
-		gf_route_route_session_del(routedmx, rsess);
+		gf_route_route_session_del(routedmx, s, rsess);
 	}
 	gf_list_del(s->route_sessions);
 
+	if (s->pending_pcks) {
+		gf_route_service_flush_packets(s);
+		gf_list_del(s->pending_pcks);
+	}
+
 	if (s->dst_ip) gf_free(s->dst_ip);
 	if (s->log_name) gf_free(s->log_name);
 	if (s->service_identifier) gf_free(s->service_identifier);
@@ -322,8 +553,16 @@ static void gf_route_service_del(GF_ROUTEDmx *routedmx, GF_ROUTEService *s)
 GF_EXPORT
 void gf_route_dmx_del(GF_ROUTEDmx *routedmx)
 {
+	u32 i;
 	if (!routedmx) return;
 
+	//stop reception before destroying sockets
+	for (i=0; i<routedmx->nb_workers; i++) {
+		GF_ROUTEWorker *w = routedmx->workers[i];
+		w->run = GF_FALSE;
+		gf_th_stop(w->th);
+	}
+
 	if (routedmx->buffer) gf_free(routedmx->buffer);
 	if (routedmx->unz_buffer) gf_free(routedmx->unz_buffer);
 	if (routedmx->atsc_sock) gf_sk_del(routedmx->atsc_sock);
@@ -345,6 +584,10 @@ void gf_route_dmx_del(GF_ROUTEDmx *routedmx)
 		gf_list_del(routedmx->object_reservoir);
 	}
 	if (routedmx->bs) gf_bs_del(routedmx->bs);
+	for (i=0; i<routedmx->nb_workers; i++) {
+		gf_route_worker_del(routedmx->workers[i]);
+	}
+	if (routedmx->workers) gf_free(routedmx->workers);
 	gf_free(routedmx);
 }
 
@@ -448,16 +691,16 @@ static void gf_route_register_service_sockets(GF_ROUTEDmx *routedmx, GF_ROUTESer
 {
     u32 i;
     GF_ROUTESession *rsess;
-    if (do_register) gf_sk_group_register(routedmx->active_sockets, s->sock);
-    else gf_sk_group_unregister(routedmx->active_sockets, s->sock);
+    if (do_register) gf_route_sock_register(routedmx, s, s->sock);
+    else gf_route_sock_unregister(routedmx, s, s->sock);
 
     if (!s->secondary_sockets) return;
 
     i=0;
     while ((rsess = gf_list_enum(s->route_sessions, &i))) {
         if (! rsess->sock) continue;
-        if (do_register) gf_sk_group_register(routedmx->active_sockets, rsess->sock);
-        else gf_sk_group_unregister(routedmx->active_sockets, rsess->sock);
+        if (do_register) gf_route_sock_register(routedmx, s, rsess->sock);
+        else gf_route_sock_unregister(routedmx, s, rsess->sock);
     }
 }
 
@@ -516,6 +759,11 @@ static GF_ROUTEService *gf_route_create_service(GF_ROUTEDmx *routedmx, const cha
 	service->port = dst_port;
 	service->objects = gf_list_new();
 	service->route_sessions = gf_list_new();
+	if (routedmx->nb_workers) {
+		service->worker = routedmx->workers[routedmx->next_worker % routedmx->nb_workers];
+		routedmx->next_worker++;
+		service->pending_pcks = gf_list_new();
+	}
 
 	gf_list_add(routedmx->services, service);
 
@@ -523,7 +771,7 @@ static GF_ROUTEService *gf_route_create_service(GF_ROUTEDmx *routedmx, const cha
 	//always on
 	if ((protocol_type == GF_SERVICE_DVB_FLUTE) && !service_id) {
 		service->tune_mode = GF_ROUTE_TUNE_ON;
-		gf_sk_group_register(routedmx->active_sockets, service->sock);
+		gf_route_sock_register(routedmx, service, service->sock);
 		return service;
 	}
 
@@ -544,7 +792,7 @@ static GF_ROUTEService *gf_route_create_service(GF_ROUTEDmx *routedmx, const cha
 	} else {
 		service->tune_mode = GF_ROUTE_TUNE_ON;
 		routedmx->service_autotune = service_id;
-		gf_sk_group_register(routedmx->active_sockets, service->sock);
+		gf_route_sock_register(routedmx, service, service->sock);
 	}
 	if (routedmx->on_event)
 		routedmx->on_event(routedmx->udta, GF_ROUTE_EVT_SERVICE_FOUND, service_id, NULL);
@@ -598,8 +846,7 @@ GF_ROUTEDmx *gf_dvb_mabr_dmx_new(const char *ip, u32 port, const char *ifce, u32
 	return routedmx;
 }
 
-GF_EXPORT
-GF_Err gf_route_atsc3_tune_in(GF_ROUTEDmx *routedmx, u32 serviceID, Bool tune_all_sls)
+static GF_Err gf_route_atsc3_tune_in_internal(GF_ROUTEDmx *routedmx, u32 serviceID, Bool tune_all_sls)
 {
 	u32 i;
 	GF_ROUTEService *s;
@@ -638,6 +885,17 @@ GF_Err gf_route_atsc3_tune_in(GF_ROUTEDmx *routedmx, u32 serviceID, Bool tune_al
 	return GF_OK;
 }
 
+GF_EXPORT
+GF_Err gf_route_atsc3_tune_in(GF_ROUTEDmx *routedmx, u32 serviceID, Bool tune_all_sls)
+{
+	GF_Err e;
+	if (!routedmx) return GF_BAD_PARAM;
+	gf_route_dmx_pause_workers(routedmx, GF_TRUE);
+	e = gf_route_atsc3_tune_in_internal(routedmx, serviceID, tune_all_sls);
+	gf_route_dmx_pause_workers(routedmx, GF_FALSE);
+	return e;
+}
+
 GF_EXPORT
 GF_Err gf_route_dmx_set_reorder(GF_ROUTEDmx *routedmx, Bool force_reorder, u32 timeout_ms)
 {
@@ -792,6 +1050,8 @@ static void gf_route_obj_to_reservoir(GF_ROUTEDmx *routedmx, GF_ROUTEService *s,
 	GF_LOG(GF_LOG_DEBUG, GF_LOG_ROUTE, ("[%s] Moving object tsi %u toi %u to reservoir (status %s)\n", s->log_name, obj->tsi, obj->toi, get_lct_obj_status_name(obj->status) ));
 
 	if (s->last_active_obj==obj) s->last_active_obj = NULL;
+	if (s->push_obj==obj) s->push_obj = NULL;
+	if (s->done_obj==obj) s->done_obj = NULL;
 	obj->closed_flag = 0;
 	obj->force_keep = 0;
 	obj->nb_bytes = 0;
@@ -808,6 +1068,7 @@ static void gf_route_obj_to_reservoir(GF_ROUTEDmx *routedmx, GF_ROUTEService *s,
 		gf_free(obj->rlct_file);
 	}
 	obj->rlct_file = NULL;
+	gf_route_service_unhash_object(s, obj);
 	obj->toi = 0;
     obj->tsi = 0;
 	obj->udta = NULL;
@@ -935,8 +1196,9 @@ static GF_Err gf_route_dmx_push_object(GF_ROUTEDmx *routedmx, GF_ROUTEService *s
         gf_mx_p(obj->blob.mx);
 		obj->blob.data = obj->payload;
 		if (final_push) {
+			//no total size, use end of last received fragment (payload may be over-allocated)
 			if (!obj->total_length)
-				obj->total_length = obj->alloc_size;
+				obj->total_length = obj->nb_frags ? (obj->frags[obj->nb_frags-1].offset + obj->frags[obj->nb_frags-1].size) : 0;
 			obj->blob.size = (u32) obj->total_length;
 		} else {
 			obj->blob.size = (u32) bytes_done;
@@ -1051,7 +1313,7 @@ static GF_Err gf_route_dmx_process_dvb_flute_signaling(GF_ROUTEDmx *routedmx, GF
 			obj = gf_list_get(s->objects, i);
 			if ((obj->toi==toi) && (obj->tsi==tsi)) break;
 			if ((obj->tsi==tsi) && obj->rlct_file && !strcmp(obj->rlct_file->filename, content_location)) {
-				obj->toi = toi;
+				gf_route_service_set_object_toi(s, obj, toi);
 				break;
 			}
 			obj=NULL;
@@ -1102,6 +1364,7 @@ static GF_Err gf_route_dmx_process_dvb_flute_signaling(GF_ROUTEDmx *routedmx, GF
 				}
 				GF_FLUTELLMapEntry *ll_map = &obj->ll_map[obj->ll_maps_count];
 				obj->ll_maps_count++;
+				s->has_ll_maps = GF_TRUE;
 				if (obj->rlct_file) obj->rlct_file->can_remove = GF_FALSE;
 				ll_map->toi = toi;
 				ll_map->offset = ll_offset;
@@ -1214,6 +1477,7 @@ static GF_Err gf_route_dmx_process_dvb_flute_signaling(GF_ROUTEDmx *routedmx, GF
 					obj->ll_map = gf_malloc(sizeof(GF_FLUTELLMapEntry)*obj->ll_maps_alloc);
 				}
 				obj->ll_maps_count = 1;
+				s->has_ll_maps = GF_TRUE;
 				GF_FLUTELLMapEntry *ll_map = &obj->ll_map[0];
 				memset(ll_map, 0, sizeof(GF_FLUTELLMapEntry));
 				ll_map->toi = toi;
@@ -1227,7 +1491,7 @@ static GF_Err gf_route_dmx_process_dvb_flute_signaling(GF_ROUTEDmx *routedmx, GF
 		}
 		if (query_sep) query_sep[0] = 0;
 		else if (frag_sep) frag_sep[0] = 0;
-		gf_list_add(s->objects, obj);
+		gf_route_service_add_object(s, obj);
 	}
 	return GF_OK;
 }
@@ -1456,7 +1720,7 @@ static GF_Err gf_route_dmx_process_dvb_mcast_signaling(GF_ROUTEDmx *routedmx, GF
 					//gf_sk_set_block_mode(rsess->sock, GF_TRUE);
 					new_s->secondary_sockets++;
 					if (new_s->tune_mode == GF_ROUTE_TUNE_ON)
-						gf_sk_group_register(routedmx->active_sockets, rsess->sock);
+						gf_route_sock_register(routedmx, new_s, rsess->sock);
 
 					rsess->mcast_addr = gf_strdup(dst_add);
 					rsess->mcast_port = dst_port;
@@ -1536,7 +1800,7 @@ static GF_Err gf_route_dmx_process_dvb_mcast_signaling(GF_ROUTEDmx *routedmx, GF
 		//purge old LCT sessions
 		while (gf_list_count(old_sessions)) {
 			GF_ROUTESession *rsess = gf_list_pop_back(old_sessions);
-			gf_route_route_session_del(routedmx, rsess);
+			gf_route_route_session_del(routedmx, new_s, rsess);
 		}
 		gf_list_del(old_sessions);
 
@@ -1628,11 +1892,165 @@ static GF_Err gf_route_service_flush_object(GF_ROUTEService *s, GF_LCTObject *ob
 	return GF_EOS;
 }
 
-static GF_Err gf_route_service_gather_object(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, u32 tsi, u32 toi, u32 start_offset, char *data, u32 size, u32 total_len, Bool close_flag, Bool in_order, GF_ROUTELCTChannel *rlct, GF_LCTObject **gather_obj, s32 flute_esi, u32 fdt_symbol_length)
+//appends data to an object being gathered, returns GF_EOS once the object is done
+static GF_Err gf_route_service_append_object(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, GF_LCTObject *obj, GF_FLUTELLMapEntry *ll_map, u32 tsi, u32 toi, u32 start_offset, char *data, u32 size, Bool close_flag, Bool defer_push)
 {
 	Bool done;
+	u32 i;
+	Bool do_push = GF_FALSE;
+
+	obj->last_gather_time = gf_sys_clock_high_res();
+	obj->blob.last_modification_time = obj->last_gather_time;
+
+    if (!size) {
+		GF_LOG(GF_LOG_DEBUG, GF_LOG_ROUTE, ("[%s] Empty LCT packet TSI %u TOI %u\n", s->log_name, tsi, toi));
+        goto check_done;
+    }
+	obj->nb_recv_bytes += size;
+
+	gf_assert((ll_map ? ll_map->toi : obj->toi) == toi);
+	gf_assert(obj->tsi == tsi);
+	if (start_offset + size > obj->alloc_size) {
+		obj->alloc_size = start_offset + size;
+		//use total size if available
+		if (obj->alloc_size < obj->total_length)
+			obj->alloc_size = obj->total_length;
+		//for signaling objects, we set byte after last to 0 to use string functions
+		if (!tsi)
+			obj->alloc_size++;
+		//no total size known for media object, grow geometrically to avoid a realloc per packet
+		else if (!obj->total_length && (obj->alloc_size < 2*(u64)obj->blob.size))
+			obj->alloc_size = 2*obj->blob.size;
+        gf_mx_p(routedmx->blob_mx);
+		obj->payload = gf_realloc(obj->payload, obj->alloc_size+1);
+		obj->payload[obj->alloc_size] = 0;
+        obj->blob.data = obj->payload;
+		if (tsi && !obj->total_length)
+			obj->blob.size = start_offset + size;
+		else
+			obj->blob.size = obj->alloc_size;
+        gf_mx_v(routedmx->blob_mx);
+    }
+	gf_assert(obj->alloc_size >= start_offset + size);
+
+	//copy data before updating fragments, as received ranges may be checked by blob readers in other threads
+	memcpy(obj->payload + start_offset, data, size);
+
+	gf_mx_p(obj->blob.mx);
+	//fragments are sorted and disjoint: locate first fragment ending at or after start_offset,
+	//and first fragment starting after the end of received data
+	u32 start_frag, end_frag, hi = obj->nb_frags;
+	start_frag = 0;
+	while (start_frag < hi) {
+		u32 mid = (start_frag + hi) / 2;
+		if (start_offset <= obj->frags[mid].offset + obj->frags[mid].size) hi = mid;
+		else start_frag = mid+1;
+	}
+	end_frag = start_frag;
+	hi = obj->nb_frags;
+	while (end_frag < hi) {
+		u32 mid = (end_frag + hi) / 2;
+		if (start_offset + size < obj->frags[mid].offset) hi = mid;
+		else end_frag = mid+1;
+	}
+
+
+	//only push on first packet of object
+	if (!start_frag) {
+		if (routedmx->dispatch_mode==GF_ROUTE_DISPATCH_OUT_OF_ORDER) {
+			do_push = GF_TRUE;
+		} else if (!start_offset && (routedmx->dispatch_mode==GF_ROUTE_DISPATCH_PROGRESSIVE)) {
+			do_push = GF_TRUE;
+		}
+	}
+
+	if (start_frag == end_frag) {
+		// insert new fragment between two already received fragments or at the end
+		if (obj->nb_frags==obj->nb_alloc_frags) {
+			obj->nb_alloc_frags *= 2;
+			obj->frags = gf_realloc(obj->frags, sizeof(GF_LCTFragInfo)*obj->nb_alloc_frags);
+		}
+		memmove(&obj->frags[start_frag+1], &obj->frags[start_frag], sizeof(GF_LCTFragInfo) * (obj->nb_frags - start_frag));
+		obj->frags[start_frag].offset = start_offset;
+		obj->frags[start_frag].size = size;
+		obj->nb_bytes += size;
+		obj->nb_frags++;
+	} else {
+		u32 old_size = 0;
+		u32 end = MAX(start_offset+size, obj->frags[end_frag-1].offset+obj->frags[end_frag-1].size);
+		//bytes covered by the fragments being extended or merged
+		for (i=start_frag; i<end_frag; i++)
+			old_size += obj->frags[i].size;
+
+		obj->frags[start_frag].offset = MIN(obj->frags[start_frag].offset, start_offset);
+		obj->frags[start_frag].size = end - obj->frags[start_frag].offset;
+		obj->nb_bytes += obj->frags[start_frag].size - old_size;
+
+		if(end_frag == start_frag + 1) {
+			// received data extends fragment of index start_frag
+			if(obj->frags[start_frag].size < old_size + size) {
+				GF_LOG(GF_LOG_DEBUG, GF_LOG_ROUTE, ("[%s] Overlapping or already received LCT fragment [%u, %u]\n", s->log_name, start_offset, start_offset+size-1));
+			}
+			//adding bytes in first frag, we can push
+			if (!start_frag && !obj->frags[0].offset)
+				do_push = GF_TRUE;
+
+		} else {
+			GF_LOG(GF_LOG_DEBUG, GF_LOG_ROUTE, ("[%s] Merging LCT fragment\n", s->log_name));
+			memmove(&obj->frags[start_frag+1], &obj->frags[end_frag], sizeof(GF_LCTFragInfo) * (obj->nb_frags - end_frag));
+			obj->nb_frags += start_frag - end_frag + 1;
+		}
+	}
+
+	obj->nb_recv_frags++;
+	obj->status = GF_LCT_OBJ_RECEPTION;
+	gf_mx_v(obj->blob.mx);
+
+	GF_LOG(GF_LOG_DEBUG, GF_LOG_ROUTE, ("[%s] TSI %u TOI %u append LCT fragment (%d/%d), offset %u total size %u recv bytes %u - offset diff since last %d\n", s->log_name, obj->tsi, toi, start_frag, obj->nb_frags, start_offset, obj->total_length, obj->nb_bytes, (s32) start_offset - (s32) obj->prev_start_offset));
+
+	obj->prev_start_offset = start_offset;
+	gf_assert((ll_map ? ll_map->toi : obj->toi) == toi);
+	gf_assert(obj->tsi == tsi);
+
+    //media file (uses templates->segment or is FLUTE obj), push if we can
+    if (do_push && obj->rlct && ((!obj->rlct_file && !obj->flute_type) || (obj->flute_type==GF_FLUTE_OBJ))) {
+		//progress is notified by the demuxer thread
+		if (defer_push) s->push_obj = obj;
+		else gf_route_dmx_push_object(routedmx, s, obj, GF_FALSE);
+    }
+	//if no TOL specified, update blob size - no need to lock the mutex as we only increase the size but do not change the data pointer
+    if (!obj->total_length && (start_offset+size > obj->blob.size))
+		obj->blob.size = start_offset+size;
+
+check_done:
+	//check if we are done
+	done = GF_FALSE;
+	if (obj->total_length && (!ll_map || obj->ll_map_last)) {
+		if (obj->nb_bytes >= obj->total_length) {
+			done = GF_TRUE;
+		}
+		else if (close_flag) {
+			GF_LOG(GF_LOG_DEBUG, GF_LOG_ROUTE, ("[%s] Object TSI %u TOI %u closed flag found (object not yet completed)\n", s->log_name, tsi, toi ));
+			done = GF_TRUE;
+		}
+	} else {
+		if (close_flag && (!ll_map || obj->ll_map_last)) obj->closed_flag = 1;
+	}
+	if (!done) return GF_OK;
+
+	s->last_active_obj = NULL;
+	if (obj->rlct) {
+		obj->rlct->last_dispatched_tsi = obj->tsi;
+		obj->rlct->last_dispatched_toi = obj->toi;
+	} else {
+		s->last_dispatched_toi_on_tsi_zero = obj->toi;
+	}
+	return gf_route_service_flush_object(s, obj);
+}
+
+static GF_Err gf_route_service_gather_object(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, u32 tsi, u32 toi, u32 start_offset, char *data, u32 size, u32 total_len, Bool close_flag, Bool in_order, GF_ROUTELCTChannel *rlct, GF_LCTObject **gather_obj, s32 flute_esi, u32 fdt_symbol_length)
+{
 	u32 i, j, count;
-    Bool do_push = GF_FALSE;
 	GF_LCTObject *obj = s->last_active_obj;
 	GF_FLUTELLMapEntry *ll_map = NULL;
 
@@ -1688,7 +2106,12 @@ static GF_Err gf_route_service_gather_object(GF_ROUTEDmx *routedmx, GF_ROUTEServ
 	}
 
 	if (!obj || (obj->tsi!=tsi) || (obj->toi!=toi) || obj->ll_maps_count) {
-		count = gf_list_count(s->objects);
+		obj = NULL;
+		//low-latency chunk maps take precedence over direct TOI match, scan in list order
+		if (!s->has_ll_maps)
+			obj = gf_route_service_find_object(s, tsi, toi);
+		//not found, check for chunk maps or new version of signaling bundle
+		count = (obj || (tsi && !s->has_ll_maps)) ? 0 : gf_list_count(s->objects);
 		for (i=0; i<count; i++) {
 			obj = gf_list_get(s->objects, i);
 
@@ -1705,6 +2128,7 @@ static GF_Err gf_route_service_gather_object(GF_ROUTEDmx *routedmx, GF_ROUTEServ
 
 			if (!tsi && !obj->tsi && ((obj->toi&0xFFFFFF00) == (toi&0xFFFFFF00)) ) {
 				//change in version of bundle but same other flags: reuse this one
+				gf_route_service_set_object_toi(s, obj, toi);
 				obj->nb_frags = obj->nb_recv_frags = 0;
 				obj->nb_bytes = obj->nb_recv_bytes = 0;
 				obj->total_length = total_len;
@@ -1716,7 +2140,6 @@ static GF_Err gf_route_service_gather_object(GF_ROUTEDmx *routedmx, GF_ROUTEServ
 					obj->blob.data = obj->payload;
 					gf_mx_v(routedmx->blob_mx);
 				}
-				obj->toi = toi;
 				obj->rlct = rlct;
 				obj->status = GF_LCT_OBJ_INIT;
 				break;
@@ -1798,7 +2221,7 @@ static GF_Err gf_route_service_gather_object(GF_ROUTEDmx *routedmx, GF_ROUTEServ
 
 		}
 		obj->start_time_ms = gf_sys_clock();
-		gf_list_add(s->objects, obj);
+		gf_route_service_add_object(s, obj);
 	} else if (!obj->total_length && total_len) {
 		GF_LOG(GF_LOG_INFO, GF_LOG_ROUTE, ("[%s] Object TSI %u TOI %u was started without total-length assigned, assigning to %u\n", s->log_name, tsi, toi, total_len));
 		// Check if there are no fragments in the object that extend beyond the total length
@@ -1930,145 +2353,38 @@ static GF_Err gf_route_service_gather_object(GF_ROUTEDmx *routedmx, GF_ROUTEServ
 		}
 		return GF_EOS;
 	}
-	obj->last_gather_time = gf_sys_clock_high_res();
-	obj->blob.last_modification_time = obj->last_gather_time;
-
-    if (!size) {
-		GF_LOG(GF_LOG_DEBUG, GF_LOG_ROUTE, ("[%s] Empty LCT packet TSI %u TOI %u\n", s->log_name, tsi, toi));
-        goto check_done;
-    }
-	obj->nb_recv_bytes += size;
-
-	int start_frag = -1;
-	int end_frag = -1;
-	for (i=0; (i < obj->nb_frags) && (start_frag==-1 || end_frag==-1); i++) {
-		if((start_frag == -1) && (start_offset <= obj->frags[i].offset + obj->frags[i].size)) {
-			start_frag = i;
-		}
-
-		if((end_frag == -1) && (start_offset + size < obj->frags[i].offset)) {
-			end_frag = i;
-		}
-	}
-	if(start_frag == -1) {
-		start_frag = obj->nb_frags;
-	}
-	if(end_frag == -1) {
-		end_frag = obj->nb_frags;
-	}
-
-
-	//only push on first packet of object
-	if (!start_frag) {
-		if (routedmx->dispatch_mode==GF_ROUTE_DISPATCH_OUT_OF_ORDER) {
-			do_push = GF_TRUE;
-		} else if (!start_offset && (routedmx->dispatch_mode==GF_ROUTE_DISPATCH_PROGRESSIVE)) {
-			do_push = GF_TRUE;
-		}
-	}
-
-	if (start_frag == end_frag) {
-		// insert new fragment between two already received fragments or at the end
-		if (obj->nb_frags==obj->nb_alloc_frags) {
-			obj->nb_alloc_frags *= 2;
-			obj->frags = gf_realloc(obj->frags, sizeof(GF_LCTFragInfo)*obj->nb_alloc_frags);
-		}
-		memmove(&obj->frags[start_frag+1], &obj->frags[start_frag], sizeof(GF_LCTFragInfo) * (obj->nb_frags - start_frag));
-		obj->frags[start_frag].offset = start_offset;
-		obj->frags[start_frag].size = size;
-		obj->nb_bytes += size;
-		obj->nb_frags++;
-	} else {
-		int old_size = obj->frags[start_frag].size;
-
-		int end = MAX(start_offset+size, obj->frags[end_frag-1].offset+obj->frags[end_frag-1].size);
-		obj->frags[start_frag].offset = MIN(obj->frags[start_frag].offset, start_offset);
-		obj->frags[start_frag].size = end - obj->frags[start_frag].offset;
-
-		if(end_frag == start_frag + 1) {
-			// received data extends fragment of index start_frag
-			if(obj->frags[start_frag].size < old_size + size) {
-				GF_LOG(GF_LOG_DEBUG, GF_LOG_ROUTE, ("[%s] Overlapping or already received LCT fragment [%u, %u]\n", s->log_name, start_offset, start_offset+size-1));
-			}
-			obj->nb_bytes += obj->frags[start_frag].size - old_size;
-			//adding bytes in first frag, we can push
-			if (!start_frag && !obj->frags[0].offset)
-				do_push = GF_TRUE;
-
-		} else if(end_frag > start_frag + 1) {
-			GF_LOG(GF_LOG_DEBUG, GF_LOG_ROUTE, ("[%s] Merging LCT fragment\n", s->log_name));
-			memmove(&obj->frags[start_frag+1], &obj->frags[end_frag], sizeof(GF_LCTFragInfo) * (obj->nb_frags - end_frag));
-			obj->nb_frags += start_frag - end_frag + 1;
-
-			obj->nb_bytes = 0;
-			u32 i;
-			for(i=0; i < obj->nb_frags; i++) {
-				obj->nb_bytes += obj->frags[i].size;
-			}
-		}
-	}
-
-	obj->nb_recv_frags++;
-	obj->status = GF_LCT_OBJ_RECEPTION;
-
-	gf_assert((ll_map ? ll_map->toi : obj->toi) == toi);
-	gf_assert(obj->tsi == tsi);
-	if (start_offset + size > obj->alloc_size) {
-		obj->alloc_size = start_offset + size;
-		//use total size if available
-		if (obj->alloc_size < obj->total_length)
-			obj->alloc_size = obj->total_length;
-		//for signaling objects, we set byte after last to 0 to use string functions
-		if (!tsi)
-			obj->alloc_size++;
-        gf_mx_p(routedmx->blob_mx);
-		obj->payload = gf_realloc(obj->payload, obj->alloc_size+1);
-		obj->payload[obj->alloc_size] = 0;
-        obj->blob.data = obj->payload;
-        obj->blob.size = obj->alloc_size;
-        gf_mx_v(routedmx->blob_mx);
-    }
-	gf_assert(obj->alloc_size >= start_offset + size);
-
-	memcpy(obj->payload + start_offset, data, size);
-	GF_LOG(GF_LOG_DEBUG, GF_LOG_ROUTE, ("[%s] TSI %u TOI %u append LCT fragment (%d/%d), offset %u total size %u recv bytes %u - offset diff since last %d\n", s->log_name, obj->tsi, toi, start_frag, obj->nb_frags, start_offset, obj->total_length, obj->nb_bytes, (s32) start_offset - (s32) obj->prev_start_offset));
-
-	obj->prev_start_offset = start_offset;
-	gf_assert((ll_map ? ll_map->toi : obj->toi) == toi);
-	gf_assert(obj->tsi == tsi);
+	return gf_route_service_append_object(routedmx, s, obj, ll_map, tsi, toi, start_offset, data, size, close_flag, GF_FALSE);
+}
 
-    //media file (uses templates->segment or is FLUTE obj), push if we can
-    if (do_push && obj->rlct && ((!obj->rlct_file && !obj->flute_type) || (obj->flute_type==GF_FLUTE_OBJ))) {
-        gf_route_dmx_push_object(routedmx, s, obj, GF_FALSE);
-    }
-	//if no TOL specified, update blob size - no need to lock the mutex as we only increase the size but do not change the data pointer
-    if (!obj->total_length && (start_offset+size > obj->blob.size))
-		obj->blob.size = start_offset+size;
+/*worker version of gather: only appends data to the object being received on the service. Packets creating, flushing or
+notifying objects are left to the demuxer thread, GF_PENDING_PACKET is then returned before any state is modified*/
+static GF_Err gf_route_service_gather_object_worker(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, u32 tsi, u32 toi, u32 start_offset, char *data, u32 size, u32 total_len, Bool close_flag, GF_ROUTELCTChannel *rlct, s32 flute_esi, u32 fdt_symbol_length)
+{
+	GF_LCTObject *obj = s->last_active_obj;
 
-check_done:
-	//check if we are done
-	done = GF_FALSE;
-	if (obj->total_length && (!ll_map || obj->ll_map_last)) {
-		if (obj->nb_bytes >= obj->total_length) {
-			done = GF_TRUE;
-		}
-		else if (close_flag) {
-			GF_LOG(GF_LOG_DEBUG, GF_LOG_ROUTE, ("[%s] Object TSI %u TOI %u closed flag found (object not yet completed)\n", s->log_name, tsi, toi ));
-			done = GF_TRUE;
-		}
-	} else {
-		if (close_flag && (!ll_map || obj->ll_map_last)) obj->closed_flag = 1;
+	if (!tsi || fdt_symbol_length || !rlct || !rlct->is_active)
+		return GF_PENDING_PACKET;
+	if (!obj || (obj->tsi!=tsi) || (obj->toi!=toi) || obj->ll_maps_count || (obj->status!=GF_LCT_OBJ_RECEPTION))
+		return GF_PENDING_PACKET;
+	//late data
+	if ((tsi==rlct->last_dispatched_tsi) && (toi==rlct->last_dispatched_toi))
+		return GF_PENDING_PACKET;
+
+	if (s->protocol==GF_SERVICE_DVB_FLUTE) {
+		if (obj->flute_nb_symbols && (obj->flute_nb_symbols <= (u32) flute_esi))
+			return GF_PENDING_PACKET;
+		start_offset = flute_esi * obj->flute_symbol_size;
+		total_len = obj->total_length;
 	}
-	if (!done) return GF_OK;
+	//size changes and errors are handled by the demuxer thread
+	if (total_len && (total_len != obj->total_length))
+		return GF_PENDING_PACKET;
+	if ((u64)start_offset + size > (obj->total_length ? obj->total_length : GF_UINT_MAX))
+		return GF_PENDING_PACKET;
 
-	s->last_active_obj = NULL;
-	if (obj->rlct) {
-		obj->rlct->last_dispatched_tsi = obj->tsi;
-		obj->rlct->last_dispatched_toi = obj->toi;
-	} else {
-		s->last_dispatched_toi_on_tsi_zero = obj->toi;
-	}
-	return gf_route_service_flush_object(s, obj);
+	if (gf_route_service_append_object(routedmx, s, obj, NULL, tsi, toi, start_offset, data, size, close_flag, GF_TRUE)==GF_EOS)
+		s->done_obj = obj;
+	return GF_OK;
 }
 
 static GF_Err gf_route_service_setup_dash(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, char *content, char *content_location, u32 file_type)
@@ -2270,7 +2586,7 @@ static GF_Err gf_route_service_setup_stsid(GF_ROUTEDmx *routedmx, GF_ROUTEServic
 				gf_sk_set_buffer_size(rsess->sock, GF_FALSE, routedmx->unz_buffer_size);
 				//gf_sk_set_block_mode(rsess->sock, GF_TRUE);
 				s->secondary_sockets++;
-				if (s->tune_mode == GF_ROUTE_TUNE_ON) gf_sk_group_register(routedmx->active_sockets, rsess->sock);
+				if (s->tune_mode == GF_ROUTE_TUNE_ON) gf_route_sock_register(routedmx, s, rsess->sock);
 
 				rsess->mcast_addr = gf_strdup(dst_ip);
 				rsess->mcast_port = dst_port;
@@ -2569,7 +2885,7 @@ static GF_Err gf_route_service_setup_stsid(GF_ROUTEDmx *routedmx, GF_ROUTEServic
 	while (gf_list_count(remove_sessions)) {
 		GF_ROUTESession *rsess = gf_list_pop_back(remove_sessions);
 		gf_list_del_item(s->route_sessions, rsess);
-		gf_route_route_session_del(routedmx, rsess);
+		gf_route_route_session_del(routedmx, s, rsess);
 	}
 	gf_list_del(remove_sessions);
 
@@ -2758,46 +3074,33 @@ static GF_Err gf_route_dmx_process_service_signaling(GF_ROUTEDmx *routedmx, GF_R
 
 #define GF_ROUTE_MAX_SIZE 0x40000000
 
-static GF_Err dmx_process_service_route(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, GF_ROUTESession *route_sess)
+static GF_Err dmx_process_service_route(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, GF_ROUTEWorker *w, u8 *data, u32 nb_read)
 {
 	GF_Err e;
-	u32 nb_read, v, C, psi, S, O, H, /*Res, A,*/ B, hdr_len, cp, cc, tsi, toi, pos;
+	u32 v, C, psi, S, O, H, /*Res, A,*/ B, hdr_len, cp, cc, tsi, toi, pos;
 	u32 /*a_G=0, a_U=0,*/ a_S=0, a_M=0/*, a_A=0, a_H=0, a_D=0*/;
 	u64 tol_size=0;
 	Bool in_order = GF_TRUE;
 	u32 start_offset;
 	GF_ROUTELCTChannel *rlct=NULL;
 	GF_LCTObject *gather_object=NULL;
+	GF_BitStream *bs = w ? w->bs : routedmx->bs;
 
-	if (route_sess) {
-		e = gf_sk_receive_no_select(route_sess->sock, routedmx->buffer, routedmx->buffer_size, &nb_read);
-	} else {
-		e = gf_sk_receive_no_select(s->sock, routedmx->buffer, routedmx->buffer_size, &nb_read);
-	}
-
-	if (e != GF_OK) return e;
-	gf_assert(nb_read);
-
-	routedmx->nb_packets++;
-	routedmx->total_bytes_recv += nb_read;
-	routedmx->last_pck_time = gf_sys_clock_high_res();
-	if (!routedmx->first_pck_time) routedmx->first_pck_time = routedmx->last_pck_time;
-
-	e = gf_bs_reassign_buffer(routedmx->bs, routedmx->buffer, nb_read);
+	e = gf_bs_reassign_buffer(bs, data, nb_read);
 	if (e != GF_OK) return e;
 
 	//parse LCT header
-	v = gf_bs_read_int(routedmx->bs, 4);
-	C = gf_bs_read_int(routedmx->bs, 2);
-	psi = gf_bs_read_int(routedmx->bs, 2);
-	S = gf_bs_read_int(routedmx->bs, 1);
-	O = gf_bs_read_int(routedmx->bs, 2);
-	H = gf_bs_read_int(routedmx->bs, 1);
-	/*Res = */gf_bs_read_int(routedmx->bs, 2);
-	/*A = */gf_bs_read_int(routedmx->bs, 1);
-	B = gf_bs_read_int(routedmx->bs, 1);
-	hdr_len = gf_bs_read_int(routedmx->bs, 8);
-	cp = gf_bs_read_int(routedmx->bs, 8);
+	v = gf_bs_read_int(bs, 4);
+	C = gf_bs_read_int(bs, 2);
+	psi = gf_bs_read_int(bs, 2);
+	S = gf_bs_read_int(bs, 1);
+	O = gf_bs_read_int(bs, 2);
+	H = gf_bs_read_int(bs, 1);
+	/*Res = */gf_bs_read_int(bs, 2);
+	/*A = */gf_bs_read_int(bs, 1);
+	B = gf_bs_read_int(bs, 1);
+	hdr_len = gf_bs_read_int(bs, 8);
+	cp = gf_bs_read_int(bs, 8);
 
 	if (v!=1) {
 		GF_LOG(GF_LOG_ERROR, GF_LOG_ROUTE, ("[%s] Wrong LCT header version %d, expecting 1\n", s->log_name, v));
@@ -2833,9 +3136,9 @@ static GF_Err dmx_process_service_route(GF_ROUTEDmx *routedmx, GF_ROUTEService *
 		return GF_OK;
 	}
 
-	cc = gf_bs_read_u32(routedmx->bs);
-	tsi = gf_bs_read_u32(routedmx->bs);
-	toi = gf_bs_read_u32(routedmx->bs);
+	cc = gf_bs_read_u32(bs);
+	tsi = gf_bs_read_u32(bs);
+	toi = gf_bs_read_u32(bs);
 	hdr_len-=4;
 
 	//filter TSI if not 0 (service TSI) and debug mode set
@@ -2907,26 +3210,26 @@ static GF_Err dmx_process_service_route(GF_ROUTEDmx *routedmx, GF_ROUTEService *
 
 	//parse extensions
 	while (hdr_len) {
-		u32 h_pos = gf_bs_get_position(routedmx->bs);
-		u8 het = gf_bs_read_u8(routedmx->bs);
+		u32 h_pos = gf_bs_get_position(bs);
+		u8 het = gf_bs_read_u8(bs);
 		u8 hel =0 ;
 
-		if (het<=127) hel = gf_bs_read_u8(routedmx->bs);
+		if (het<=127) hel = gf_bs_read_u8(bs);
 		else hel=1;
 
 		switch (het) {
 		case GF_LCT_EXT_FDT:
-			/*flute_version = */gf_bs_read_int(routedmx->bs, 4);
-			/*fdt_instance_id = */gf_bs_read_int(routedmx->bs, 20);
+			/*flute_version = */gf_bs_read_int(bs, 4);
+			/*fdt_instance_id = */gf_bs_read_int(bs, 20);
 			break;
 
 		case GF_LCT_EXT_CENC:
-			/*content_encodind = */gf_bs_read_int(routedmx->bs, 8);
-			/*reserved = */gf_bs_read_int(routedmx->bs, 16);
+			/*content_encodind = */gf_bs_read_int(bs, 8);
+			/*reserved = */gf_bs_read_int(bs, 16);
 			break;
 
 		case GF_LCT_EXT_TOL24:
-			tol_size = gf_bs_read_int(routedmx->bs, 24);
+			tol_size = gf_bs_read_int(bs, 24);
 			if(! tol_size) {
 				GF_LOG(GF_LOG_WARNING, GF_LOG_ROUTE, ("[%s] Wrong TOL=%u value \n", s->log_name, tol_size));
 			}
@@ -2937,7 +3240,7 @@ static GF_Err dmx_process_service_route(GF_ROUTEDmx *routedmx, GF_ROUTEService *
 				GF_LOG(GF_LOG_WARNING, GF_LOG_ROUTE, ("[%s] Wrong HEL %d for TOL48 LCT extension, expecting 2\n", s->log_name, hel));
 				continue;
 			}
-			tol_size = gf_bs_read_long_int(routedmx->bs, 48);
+			tol_size = gf_bs_read_long_int(bs, 48);
 			if(! tol_size) {
 				GF_LOG(GF_LOG_WARNING, GF_LOG_ROUTE, ("[%s] Wrong TOL=%u value \n", s->log_name, tol_size));
 			}
@@ -2951,16 +3254,16 @@ static GF_Err dmx_process_service_route(GF_ROUTEDmx *routedmx, GF_ROUTEService *
 			GF_LOG(GF_LOG_WARNING, GF_LOG_ROUTE, ("[%s] Wrong HEL %d for LCT extension %d, remaining header size %d\n", s->log_name, hel, het, hdr_len));
 			continue;
 		}
-		h_pos = gf_bs_get_position(routedmx->bs) - h_pos;
+		h_pos = gf_bs_get_position(bs) - h_pos;
 		while (hel*4 > h_pos) {
 			h_pos++;
-			gf_bs_read_u8(routedmx->bs);
+			gf_bs_read_u8(bs);
 		}
 		if (hel) hdr_len -= hel;
 		else hdr_len -= 1;
 	}
 
-	start_offset = gf_bs_read_u32(routedmx->bs);
+	start_offset = gf_bs_read_u32(bs);
 	if (start_offset>=GF_ROUTE_MAX_SIZE) {
 		GF_LOG(GF_LOG_ERROR, GF_LOG_ROUTE, ("[%s] Invalid start offset %u\n", s->log_name, start_offset));
 		return GF_NON_COMPLIANT_BITSTREAM;
@@ -2969,9 +3272,12 @@ static GF_Err dmx_process_service_route(GF_ROUTEDmx *routedmx, GF_ROUTEService *
 		GF_LOG(GF_LOG_ERROR, GF_LOG_ROUTE, ("[%s] Invalid object size %u\n", s->log_name, tol_size));
 		return GF_NON_COMPLIANT_BITSTREAM;
 	}
-	pos = (u32) gf_bs_get_position(routedmx->bs);
+	pos = (u32) gf_bs_get_position(bs);
 
-	e = gf_route_service_gather_object(routedmx, s, tsi, toi, start_offset, routedmx->buffer + pos, nb_read-pos, (u32) tol_size, B, in_order, rlct, &gather_object, -1, 0);
+	if (w)
+		return gf_route_service_gather_object_worker(routedmx, s, tsi, toi, start_offset, data + pos, nb_read-pos, (u32) tol_size, B, rlct, -1, 0);
+
+	e = gf_route_service_gather_object(routedmx, s, tsi, toi, start_offset, data + pos, nb_read-pos, (u32) tol_size, B, in_order, rlct, &gather_object, -1, 0);
 
 	if (e==GF_EOS) {
 		if (!tsi) {
@@ -3001,46 +3307,33 @@ static GF_Err dmx_process_service_route(GF_ROUTEDmx *routedmx, GF_ROUTEService *
 	return GF_OK;
 }
 
-static GF_Err dmx_process_service_dvb_flute(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, GF_ROUTESession *route_sess)
+static GF_Err dmx_process_service_dvb_flute(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, GF_ROUTEWorker *w, u8 *data, u32 nb_read)
 {
 	GF_Err e;
 	u32 fdt_symbol_length=0;
-	u32 nb_read, cp , v, C, psi, S, O, H, /*Res, A,*/ B, hdr_len, tsi, toi, pos;
+	u32 cp , v, C, psi, S, O, H, /*Res, A,*/ B, hdr_len, tsi, toi, pos;
 	u64 transfert_length=0;
 	u32 start_offset=0;
 	GF_ROUTELCTChannel *rlct=NULL;
 	GF_LCTObject *gather_object=NULL;
 	u32 /*SBN,*/ESI; //Source Block Length  | Encoding Symbol  
+	GF_BitStream *bs = w ? w->bs : routedmx->bs;
 
-	if (route_sess) {
-		e = gf_sk_receive_no_select(route_sess->sock, routedmx->buffer, routedmx->buffer_size, &nb_read);
-	} else {
-		e = gf_sk_receive_no_select(s->sock, routedmx->buffer, routedmx->buffer_size, &nb_read);
-	}
-
-	if (e != GF_OK) return e;
-	gf_assert(nb_read);
-
-	routedmx->nb_packets++;
-	routedmx->total_bytes_recv += nb_read;
-	routedmx->last_pck_time = gf_sys_clock_high_res();
-	if (!routedmx->first_pck_time) routedmx->first_pck_time = routedmx->last_pck_time;
-
-	e = gf_bs_reassign_buffer(routedmx->bs, routedmx->buffer, nb_read);
+	e = gf_bs_reassign_buffer(bs, data, nb_read);
 	if (e != GF_OK) return e;
 
 	//parse LCT header
-	v = gf_bs_read_int(routedmx->bs, 4);
-	C = gf_bs_read_int(routedmx->bs, 2);
-	psi = gf_bs_read_int(routedmx->bs, 2);
-	S = gf_bs_read_int(routedmx->bs, 1);
-	O = gf_bs_read_int(routedmx->bs, 2);
-	H = gf_bs_read_int(routedmx->bs, 1);
-	/*Res = */gf_bs_read_int(routedmx->bs, 2);
-	/*A = */gf_bs_read_int(routedmx->bs, 1);
-	B = gf_bs_read_int(routedmx->bs, 1);
-	hdr_len = gf_bs_read_int(routedmx->bs, 8);
-	cp = gf_bs_read_int(routedmx->bs, 8);
+	v = gf_bs_read_int(bs, 4);
+	C = gf_bs_read_int(bs, 2);
+	psi = gf_bs_read_int(bs, 2);
+	S = gf_bs_read_int(bs, 1);
+	O = gf_bs_read_int(bs, 2);
+	H = gf_bs_read_int(bs, 1);
+	/*Res = */gf_bs_read_int(bs, 2);
+	/*A = */gf_bs_read_int(bs, 1);
+	B = gf_bs_read_int(bs, 1);
+	hdr_len = gf_bs_read_int(bs, 8);
+	cp = gf_bs_read_int(bs, 8);
 
 	if (v!=1) {
 		GF_LOG(GF_LOG_ERROR, GF_LOG_ROUTE, ("[%s] Wrong LCT header version %d, expecting 1\n", s->log_name, v));
@@ -3071,38 +3364,38 @@ static GF_Err dmx_process_service_dvb_flute(GF_ROUTEDmx *routedmx, GF_ROUTEServi
 		return GF_NON_COMPLIANT_BITSTREAM;
 	}
 
-	/*cc = */gf_bs_read_u32(routedmx->bs);
+	/*cc = */gf_bs_read_u32(bs);
 	if (H) {
-		tsi = gf_bs_read_u16(routedmx->bs);
-		toi = gf_bs_read_u16(routedmx->bs);
+		tsi = gf_bs_read_u16(bs);
+		toi = gf_bs_read_u16(bs);
 		hdr_len -= 3;
 	} else {
-		tsi = gf_bs_read_u32(routedmx->bs);
-		toi = gf_bs_read_u32(routedmx->bs);
+		tsi = gf_bs_read_u32(bs);
+		toi = gf_bs_read_u32(bs);
 		hdr_len -= 4;
 	}
 
 	//parse extensions
 	while (hdr_len) {
-		u32 h_pos = gf_bs_get_position(routedmx->bs);
-		u8 het = gf_bs_read_u8(routedmx->bs);
+		u32 h_pos = gf_bs_get_position(bs);
+		u8 het = gf_bs_read_u8(bs);
 		u8 hel =0 ;
 
-		if (het<=127) hel = gf_bs_read_u8(routedmx->bs);
+		if (het<=127) hel = gf_bs_read_u8(bs);
 		else hel=1;
 
 		switch (het) {
 		case GF_LCT_EXT_FDT:
-			/*u8 flute_version = */gf_bs_read_int(routedmx->bs, 4); // TODO: add version verification, if different than 1
-			/*u16 fdt_instance_id = */gf_bs_read_int(routedmx->bs, 20);
+			/*u8 flute_version = */gf_bs_read_int(bs, 4); // TODO: add version verification, if different than 1
+			/*u16 fdt_instance_id = */gf_bs_read_int(bs, 20);
 			break;
 
 		case GF_LCT_EXT_FTI:
 		{
-			transfert_length = gf_bs_read_int(routedmx->bs, 48);
-			/*u16 Fec_instance_ID = */gf_bs_read_int(routedmx->bs, 16);
-			fdt_symbol_length = gf_bs_read_int(routedmx->bs, 16);
-            /*u32 Maximum_source_block_length = */gf_bs_read_int(routedmx->bs, 32);
+			transfert_length = gf_bs_read_int(bs, 48);
+			/*u16 Fec_instance_ID = */gf_bs_read_int(bs, 16);
+			fdt_symbol_length = gf_bs_read_int(bs, 16);
+            /*u32 Maximum_source_block_length = */gf_bs_read_int(bs, 32);
 		}
 			break;
 
@@ -3114,19 +3407,19 @@ static GF_Err dmx_process_service_dvb_flute(GF_ROUTEDmx *routedmx, GF_ROUTEServi
 			GF_LOG(GF_LOG_WARNING, GF_LOG_ROUTE, ("[%s] Wrong HEL %d for LCT extension %d, remaining header size %d\n", s->log_name, hel, het, hdr_len));
 			continue;
 		}
-		h_pos = gf_bs_get_position(routedmx->bs) - h_pos;
+		h_pos = gf_bs_get_position(bs) - h_pos;
 		while (hel*4 > h_pos) {
 			h_pos++;
-			gf_bs_read_u8(routedmx->bs);
+			gf_bs_read_u8(bs);
 		}
 		if (hel) hdr_len -= hel;
 		else hdr_len -= 1;
 	}
 
 	//both no-code and raptor use 16 bits for each SBN and ESI
-	/*SBN =(u32) */gf_bs_read_u16(routedmx->bs);
-	ESI = (u32) gf_bs_read_u16(routedmx->bs);
-	pos = (u32) gf_bs_get_position(routedmx->bs);
+	/*SBN =(u32) */gf_bs_read_u16(bs);
+	ESI = (u32) gf_bs_read_u16(bs);
+	pos = (u32) gf_bs_get_position(bs);
 
 	if (s->last_active_obj
 		&& (s->last_active_obj->tsi==tsi)
@@ -3152,7 +3445,10 @@ static GF_Err dmx_process_service_dvb_flute(GF_ROUTEDmx *routedmx, GF_ROUTEServi
 		}
 	}
 
-	e = gf_route_service_gather_object(routedmx, s, tsi, toi, start_offset, routedmx->buffer + pos, nb_read-pos, (u32) transfert_length, B, GF_FALSE, rlct, &gather_object, ESI, fdt_symbol_length);
+	if (w)
+		return gf_route_service_gather_object_worker(routedmx, s, tsi, toi, start_offset, data + pos, nb_read-pos, (u32) transfert_length, B, rlct, ESI, fdt_symbol_length);
+
+	e = gf_route_service_gather_object(routedmx, s, tsi, toi, start_offset, data + pos, nb_read-pos, (u32) transfert_length, B, GF_FALSE, rlct, &gather_object, ESI, fdt_symbol_length);
 
 	start_offset += (nb_read ) * ESI; 
 	
@@ -3176,10 +3472,7 @@ static GF_Err gf_route_dmx_process_lls(GF_ROUTEDmx *routedmx)
 	if (e)
 		return e;
 
-	routedmx->nb_packets++;
-	routedmx->total_bytes_recv += read;
-	routedmx->last_pck_time = gf_sys_clock_high_res();
-	if (!routedmx->first_pck_time) routedmx->first_pck_time = routedmx->last_pck_time;
+	gf_route_dmx_update_stats(routedmx, read, gf_sys_clock_high_res());
 
 	lls_table_id = routedmx->buffer[0];
 	lls_group_id = routedmx->buffer[1];
@@ -3247,12 +3540,274 @@ static GF_Err gf_route_dmx_process_lls(GF_ROUTEDmx *routedmx)
 	return GF_OK;
 }
 
+static GF_Err gf_route_dmx_recv_service(GF_ROUTEDmx *routedmx, GF_ROUTEService *s, GF_Socket *sock)
+{
+	u32 nb_read;
+	GF_Err e = gf_sk_receive_no_select(sock, routedmx->buffer, routedmx->buffer_size, &nb_read);
+	if (e != GF_OK) return e;
+	gf_assert(nb_read);
+
+	gf_route_dmx_update_stats(routedmx, nb_read, gf_sys_clock_high_res());
+	return s->process_service(routedmx, s, NULL, routedmx->buffer, nb_read);
+}
+
+//called with worker mutex held
+static GF_ROUTEPacket *gf_route_worker_get_packet(GF_ROUTEWorker *w)
+{
+	GF_ROUTEPacket *pck = gf_list_pop_back(w->pck_res);
+	if (pck) return pck;
+
+	GF_SAFEALLOC(pck, GF_ROUTEPacket);
+	if (!pck) return NULL;
+	pck->data = gf_malloc(w->routedmx->buffer_size);
+	if (!pck->data) {
+		gf_free(pck);
+		return NULL;
+	}
+	return pck;
+}
+
+//maximum number of packets read in a row on a socket before checking the other sockets of the worker
+#define ROUTE_WORKER_MAX_READS	64
+
+static u32 gf_route_worker_run(void *par)
+{
+	GF_ROUTEWorker *w = (GF_ROUTEWorker *)par;
+	GF_ROUTEDmx *routedmx = w->routedmx;
+	GF_ROUTEPacket *pck = NULL;
+	u32 buffer_size = routedmx->buffer_size;
+
+	while (w->run) {
+		u32 i, j, count, nb_recv=0;
+		GF_Err e;
+
+		gf_mx_p(w->sk_mx);
+		count = gf_list_count(w->socks);
+		if (!count) {
+			gf_mx_v(w->sk_mx);
+			gf_sleep(5);
+			continue;
+		}
+		e = gf_sk_group_select(w->sockets, 5000, GF_SK_SELECT_READ);
+		if (e) {
+			gf_mx_v(w->sk_mx);
+			if (e != GF_IP_NETWORK_EMPTY) gf_sleep(1);
+			continue;
+		}
+		for (i=0; i<count; i++) {
+			GF_ROUTEWorkerSocket *ws = gf_list_get(w->socks, i);
+			GF_ROUTEService *s = ws->s;
+			if (!gf_sk_group_sock_is_set(w->sockets, ws->sock, GF_SK_SELECT_READ)) continue;
+
+			for (j=0; j<ROUTE_WORKER_MAX_READS; j++) {
+				gf_mx_p(w->mx);
+				//leave data in the socket buffer until the demuxer catches up
+				if (gf_list_count(s->pending_pcks) >= ROUTE_MAX_PENDING_PCKS) {
+					gf_mx_v(w->mx);
+					break;
+				}
+				if (!pck) pck = gf_route_worker_get_packet(w);
+				gf_mx_v(w->mx);
+				if (!pck) break;
+
+				e = gf_sk_receive_no_select(ws->sock, pck->data, buffer_size, &pck->size);
+				if (e || !pck->size) break;
+				pck->recv_time = gf_sys_clock_high_res();
+				nb_recv++;
+
+				gf_mx_p(w->mx);
+				w->nb_packets++;
+				w->nb_bytes += pck->size;
+				w->last_pck_time = pck->recv_time;
+				if (!w->first_pck_time) w->first_pck_time = pck->recv_time;
+
+				//process packet unless the demuxer thread uses the services or still has packets of this service to process
+				e = GF_PENDING_PACKET;
+				if (!w->paused && !gf_list_count(s->pending_pcks) && (s->tune_mode!=GF_ROUTE_TUNE_OFF))
+					e = s->process_service(routedmx, s, w, pck->data, pck->size);
+
+				if (e==GF_PENDING_PACKET) {
+					gf_list_add(s->pending_pcks, pck);
+					pck = NULL;
+				} else {
+					w->nb_processed++;
+				}
+				gf_mx_v(w->mx);
+			}
+		}
+		gf_mx_v(w->sk_mx);
+		//sockets are ready but all queues are full, don't spin
+		if (!nb_recv) gf_sleep(1);
+	}
+	if (pck) {
+		gf_mx_p(w->mx);
+		gf_list_add(w->pck_res, pck);
+		gf_mx_v(w->mx);
+	}
+	return 0;
+}
+
+GF_EXPORT
+GF_Err gf_route_dmx_set_threads(GF_ROUTEDmx *routedmx, u32 nb_threads)
+{
+	u32 i;
+	GF_ROUTEService *s;
+	if (!routedmx) return GF_BAD_PARAM;
+	if (routedmx->nb_workers) return GF_NOT_SUPPORTED;
+	if (!nb_threads) return GF_OK;
+
+	//netcap state is shared by all sockets and replayed in capture order, keep reception in the calling thread
+	s = gf_list_get(routedmx->services, 0);
+	if (gf_sk_has_netcap(routedmx->atsc_sock) || (s && gf_sk_has_netcap(s->sock))) {
+		GF_LOG(GF_LOG_INFO, GF_LOG_ROUTE, ("[%s] Network capture in use, disabling worker threads\n", routedmx->dvb_mabr ? "DVB-FLUTE" : "ROUTE"));
+		return GF_OK;
+	}
+
+	routedmx->workers = gf_malloc(sizeof(GF_ROUTEWorker *) * nb_threads);
+	if (!routedmx->workers) return GF_OUT_OF_MEM;
+	for (i=0; i<nb_threads; i++) {
+		GF_ROUTEWorker *w;
+		GF_SAFEALLOC(w, GF_ROUTEWorker);
+		if (!w) break;
+		w->routedmx = routedmx;
+		w->sk_mx = gf_mx_new("ROUTEWorkerSock");
+		w->mx = gf_mx_new("ROUTEWorker");
+		w->bs = gf_bs_new((char*)w, 1, GF_BITSTREAM_READ);
+		w->sockets = gf_sk_group_new();
+		w->socks = gf_list_new();
+		w->pck_res = gf_list_new();
+		w->th = gf_th_new("ROUTEWorker");
+		if (!w->sk_mx || !w->mx || !w->bs || !w->sockets || !w->socks || !w->pck_res || !w->th) {
+			gf_route_worker_del(w);
+			break;
+		}
+		routedmx->workers[i] = w;
+	}
+	routedmx->nb_workers = i;
+	if (!routedmx->nb_workers) {
+		gf_free(routedmx->workers);
+		routedmx->workers = NULL;
+		GF_LOG(GF_LOG_WARNING, GF_LOG_ROUTE, ("[%s] Failed to create worker threads\n", routedmx->dvb_mabr ? "DVB-FLUTE" : "ROUTE"));
+		return GF_OUT_OF_MEM;
+	}
+
+	//move sockets of services already created to their worker
+	i=0;
+	while ((s = gf_list_enum(routedmx->services, &i))) {
+		if (s->tune_mode != GF_ROUTE_TUNE_OFF)
+			gf_route_register_service_sockets(routedmx, s, GF_FALSE);
+		s->worker = routedmx->workers[routedmx->next_worker % routedmx->nb_workers];
+		routedmx->next_worker++;
+		s->pending_pcks = gf_list_new();
+		if (s->tune_mode != GF_ROUTE_TUNE_OFF)
+			gf_route_register_service_sockets(routedmx, s, GF_TRUE);
+	}
+
+	for (i=0; i<routedmx->nb_workers; i++) {
+		GF_ROUTEWorker *w = routedmx->workers[i];
+		w->run = GF_TRUE;
+		if (gf_th_run(w->th, gf_route_worker_run, w) != GF_OK) {
+			w->run = GF_FALSE;
+			GF_LOG(GF_LOG_ERROR, GF_LOG_ROUTE, ("[%s] Failed to start receive thread %d\n", routedmx->dvb_mabr ? "DVB-FLUTE" : "ROUTE", i+1));
+		}
+	}
+	GF_LOG(GF_LOG_INFO, GF_LOG_ROUTE, ("[%s] Using %d worker threads\n", routedmx->dvb_mabr ? "DVB-FLUTE" : "ROUTE", routedmx->nb_workers));
+	return GF_OK;
+}
+
+/*threaded mode: workers read the sockets of their services and append data to the objects being received. Object creation,
+completion and all events are handled in the caller thread: services are visited in list order, and for each service progress and
+completion of objects gathered by the worker are notified before processing at most one pending packet, so that the events of
+a service are delivered in packet order*/
+static GF_Err gf_route_dmx_process_threaded(GF_ROUTEDmx *routedmx)
+{
+	u32 i, nb_pck=0;
+	GF_Err e;
+
+	for (i=0; i<routedmx->nb_workers; i++) {
+		GF_ROUTEWorker *w = routedmx->workers[i];
+		gf_mx_p(w->mx);
+		nb_pck += w->nb_processed;
+		w->nb_processed = 0;
+		if (w->nb_packets) {
+			routedmx->nb_packets += w->nb_packets;
+			routedmx->total_bytes_recv += w->nb_bytes;
+			if (!routedmx->first_pck_time || (w->first_pck_time < routedmx->first_pck_time))
+				routedmx->first_pck_time = w->first_pck_time;
+			if (w->last_pck_time > routedmx->last_pck_time)
+				routedmx->last_pck_time = w->last_pck_time;
+			w->nb_packets = w->nb_bytes = w->first_pck_time = 0;
+		}
+		gf_mx_v(w->mx);
+	}
+
+	if (routedmx->atsc_sock) {
+		e = gf_sk_group_select(routedmx->active_sockets, 10, GF_SK_SELECT_READ);
+		if (!e && gf_sk_group_sock_is_set(routedmx->active_sockets, routedmx->atsc_sock, GF_SK_SELECT_READ)) {
+			gf_route_dmx_pause_workers(routedmx, GF_TRUE);
+			e = gf_route_dmx_process_lls(routedmx);
+			gf_route_dmx_pause_workers(routedmx, GF_FALSE);
+			if (e) return e;
+			nb_pck++;
+		}
+	}
+
+	e = GF_OK;
+	for (i=0; i<gf_list_count(routedmx->services); i++) {
+		GF_ROUTEPacket *pck;
+		GF_LCTObject *obj;
+		Bool has_work;
+		GF_ROUTEService *s = (GF_ROUTEService *)gf_list_get(routedmx->services, i);
+		GF_ROUTEWorker *w = s->worker;
+		if (!w) continue;
+		//drop packets received before the service was untuned
+		if (s->tune_mode==GF_ROUTE_TUNE_OFF) {
+			gf_route_service_flush_packets(s);
+			continue;
+		}
+		gf_mx_p(w->mx);
+		has_work = (s->push_obj || s->done_obj || gf_list_count(s->pending_pcks)) ? GF_TRUE : GF_FALSE;
+		gf_mx_v(w->mx);
+		if (!has_work) continue;
+
+		gf_route_dmx_pause_workers(routedmx, GF_TRUE);
+		obj = s->push_obj;
+		s->push_obj = NULL;
+		//progress of all data appended by the worker since last call
+		if (obj && (obj->status==GF_LCT_OBJ_RECEPTION))
+			gf_route_dmx_push_object(routedmx, s, obj, GF_FALSE);
+
+		obj = s->done_obj;
+		s->done_obj = NULL;
+		if (obj)
+			gf_route_dmx_process_object(routedmx, s, obj);
+
+		gf_mx_p(w->mx);
+		pck = gf_list_pop_front(s->pending_pcks);
+		gf_mx_v(w->mx);
+		if (pck) {
+			//service may be destroyed while processing, only use the worker afterwards
+			e = s->process_service(routedmx, s, NULL, pck->data, pck->size);
+			gf_mx_p(w->mx);
+			gf_list_add(w->pck_res, pck);
+			gf_mx_v(w->mx);
+		}
+		gf_route_dmx_pause_workers(routedmx, GF_FALSE);
+		nb_pck++;
+		if (e) return e;
+	}
+	return nb_pck ? GF_OK : GF_IP_NETWORK_EMPTY;
+}
+
 GF_EXPORT
 GF_Err gf_route_dmx_process(GF_ROUTEDmx *routedmx)
 {
 	u32 i, j, count, nb_obj=0;
 	GF_Err e;
 
+	if (routedmx->nb_workers)
+		return gf_route_dmx_process_threaded(routedmx);
+
 	//check all active sockets
 	e = gf_sk_group_select(routedmx->active_sockets, 10, GF_SK_SELECT_READ);
 	if (e) {
@@ -3296,7 +3851,7 @@ GF_Err gf_route_dmx_process(GF_ROUTEDmx *routedmx)
 				continue;
 		}
 		if (gf_sk_group_sock_is_set(routedmx->active_sockets, s->sock, GF_SK_SELECT_READ)) {
-			e = s->process_service(routedmx, s, NULL);
+			e = gf_route_dmx_recv_service(routedmx, s, s->sock);
 			if (e) return e;
 		}
 		if (s->tune_mode!=GF_ROUTE_TUNE_ON) continue;
@@ -3306,7 +3861,7 @@ GF_Err gf_route_dmx_process(GF_ROUTEDmx *routedmx)
 		j=0;
 		while ((rsess = (GF_ROUTESession *)gf_list_enum(s->route_sessions, &j) )) {
 			if (gf_sk_group_sock_is_set(routedmx->active_sockets, rsess->sock, GF_SK_SELECT_READ)) {
-				e = s->process_service(routedmx, s, rsess);
+				e = gf_route_dmx_recv_service(routedmx, s, rsess->sock);
 				if (e) return e;
 			}
 		}
@@ -3329,8 +3884,7 @@ Bool gf_route_dmx_find_atsc3_service(GF_ROUTEDmx *routedmx, u32 service_id)
 }
 
 
-GF_EXPORT
-u32 gf_route_dmx_get_object_count(GF_ROUTEDmx *routedmx, u32 service_id)
+static u32 gf_route_dmx_get_object_count_internal(GF_ROUTEDmx *routedmx, u32 service_id)
 {
 	u32 i=0;
 	GF_ROUTEService *s;
@@ -3343,6 +3897,16 @@ u32 gf_route_dmx_get_object_count(GF_ROUTEDmx *routedmx, u32 service_id)
 	return 0;
 }
 
+GF_EXPORT
+u32 gf_route_dmx_get_object_count(GF_ROUTEDmx *routedmx, u32 service_id)
+{
+	u32 nb_obj;
+	gf_route_dmx_pause_workers(routedmx, GF_TRUE);
+	nb_obj = gf_route_dmx_get_object_count_internal(routedmx, service_id);
+	gf_route_dmx_pause_workers(routedmx, GF_FALSE);
+	return nb_obj;
+}
+
 #if 0
 void gf_route_dmx_print_objects(GF_ROUTEDmx *routedmx, u32 service_id)
 {
@@ -3446,17 +4010,24 @@ static GF_Err gf_route_dmx_keep_or_remove_object_by_name(GF_ROUTEDmx *routedmx,
 GF_EXPORT
 GF_Err gf_route_dmx_force_keep_object_by_name(GF_ROUTEDmx *routedmx, u32 service_id, char *fileName)
 {
-	return gf_route_dmx_keep_or_remove_object_by_name(routedmx, service_id, fileName, GF_FALSE, GF_FALSE);
+	GF_Err e;
+	gf_route_dmx_pause_workers(routedmx, GF_TRUE);
+	e = gf_route_dmx_keep_or_remove_object_by_name(routedmx, service_id, fileName, GF_FALSE, GF_FALSE);
+	gf_route_dmx_pause_workers(routedmx, GF_FALSE);
+	return e;
 }
 
 GF_EXPORT
 GF_Err gf_route_dmx_remove_object_by_name(GF_ROUTEDmx *routedmx, u32 service_id, char *fileName, Bool purge_previous)
 {
-	return gf_route_dmx_keep_or_remove_object_by_name(routedmx, service_id, fileName, purge_previous, GF_TRUE);
+	GF_Err e;
+	gf_route_dmx_pause_workers(routedmx, GF_TRUE);
+	e = gf_route_dmx_keep_or_remove_object_by_name(routedmx, service_id, fileName, purge_previous, GF_TRUE);
+	gf_route_dmx_pause_workers(routedmx, GF_FALSE);
+	return e;
 }
 
-GF_EXPORT
-Bool gf_route_dmx_remove_first_object(GF_ROUTEDmx *routedmx, u32 service_id)
+static Bool gf_route_dmx_remove_first_object_internal(GF_ROUTEDmx *routedmx, u32 service_id)
 {
 	u32 i=0;
 	GF_ROUTEService *s=NULL;
@@ -3487,7 +4058,16 @@ Bool gf_route_dmx_remove_first_object(GF_ROUTEDmx *routedmx, u32 service_id)
 }
 
 GF_EXPORT
-void gf_route_dmx_purge_objects(GF_ROUTEDmx *routedmx, u32 service_id)
+Bool gf_route_dmx_remove_first_object(GF_ROUTEDmx *routedmx, u32 service_id)
+{
+	Bool res;
+	gf_route_dmx_pause_workers(routedmx, GF_TRUE);
+	res = gf_route_dmx_remove_first_object_internal(routedmx, service_id);
+	gf_route_dmx_pause_workers(routedmx, GF_FALSE);
+	return res;
+}
+
+static void gf_route_dmx_purge_objects_internal(GF_ROUTEDmx *routedmx, u32 service_id)
 {
 	u32 i=0;
 	GF_ROUTEService *s=NULL;
@@ -3513,6 +4093,14 @@ void gf_route_dmx_purge_objects(GF_ROUTEDmx *routedmx, u32 service_id)
 	}
 }
 
+GF_EXPORT
+void gf_route_dmx_purge_objects(GF_ROUTEDmx *routedmx, u32 service_id)
+{
+	gf_route_dmx_pause_workers(routedmx, GF_TRUE);
+	gf_route_dmx_purge_objects_internal(routedmx, service_id);
+	gf_route_dmx_pause_workers(routedmx, GF_FALSE);
+}
+
 GF_EXPORT
 void gf_route_dmx_set_service_udta(GF_ROUTEDmx *routedmx, u32 service_id, void *udta)
 {
@@ -3569,8 +4157,7 @@ void gf_route_dmx_debug_tsi(GF_ROUTEDmx *routedmx, u32 tsi)
 	if (routedmx) routedmx->debug_tsi = tsi;
 }
 
-GF_EXPORT
-GF_Err gf_route_dmx_patch_frag_info(GF_ROUTEDmx *routedmx, u32 service_id, GF_ROUTEEventFileInfo *finfo, u32 br_start, u32 br_end)
+static GF_Err gf_route_dmx_patch_frag_info_internal(GF_ROUTEDmx *routedmx, u32 service_id, GF_ROUTEEventFileInfo *finfo, u32 br_start, u32 br_end)
 {
 	u32 i=0;
 	Bool is_patched=GF_FALSE;
@@ -3582,11 +4169,7 @@ GF_Err gf_route_dmx_patch_frag_info(GF_ROUTEDmx *routedmx, u32 service_id, GF_RO
 		s = NULL;
 	}
 	if (!s) return GF_BAD_PARAM;
-	i=0;
-	while ((obj = gf_list_enum(s->objects, &i))) {
-		if ((obj->tsi == finfo->tsi) && (obj->toi == finfo->toi))
-			break;
-	}
+	obj = gf_route_service_find_object(s, finfo->tsi, finfo->toi);
 	if (!obj) return GF_BAD_PARAM;
 	gf_mx_p(obj->blob.mx);
 	if (!br_start && (br_end==obj->total_length)) {
@@ -3658,7 +4241,18 @@ GF_Err gf_route_dmx_patch_frag_info(GF_ROUTEDmx *routedmx, u32 service_id, GF_RO
 	return GF_OK;
 }
 
-GF_Err gf_route_dmx_mark_active_quality(GF_ROUTEDmx *routedmx, u32 service_id, const char *period_id, s32 as_id, const char *rep_id, Bool is_selected)
+GF_EXPORT
+GF_Err gf_route_dmx_patch_frag_info(GF_ROUTEDmx *routedmx, u32 service_id, GF_ROUTEEventFileInfo *finfo, u32 br_start, u32 br_end)
+{
+	GF_Err e;
+	if (!routedmx) return GF_BAD_PARAM;
+	gf_route_dmx_pause_workers(routedmx, GF_TRUE);
+	e = gf_route_dmx_patch_frag_info_internal(routedmx, service_id, finfo, br_start, br_end);
+	gf_route_dmx_pause_workers(routedmx, GF_FALSE);
+	return e;
+}
+
+static GF_Err gf_route_dmx_mark_active_quality_internal(GF_ROUTEDmx *routedmx, u32 service_id, const char *period_id, s32 as_id, const char *rep_id, Bool is_selected)
 {
 	u32 count, i=0;
 	if (!routedmx || !rep_id) return GF_BAD_PARAM;
@@ -3711,7 +4305,7 @@ GF_Err gf_route_dmx_mark_active_quality(GF_ROUTEDmx *routedmx, u32 service_id, c
 				return e;
 			}
 			gf_sk_set_buffer_size(*sock, GF_FALSE, routedmx->unz_buffer_size);
-			gf_sk_group_register(routedmx->active_sockets, *sock);
+			gf_route_sock_register(routedmx, s, *sock);
 			if (mcast_sess->mcast_addr)
 				s->secondary_sockets++;
 		}
@@ -3727,7 +4321,7 @@ GF_Err gf_route_dmx_mark_active_quality(GF_ROUTEDmx *routedmx, u32 service_id, c
 		//we cannot deactivate service socket in ROUTE, we need to get MPD and STSID updates
 		//for mabr (flute or route) we can
 		if (! (*nb_active) && (mcast_sess->mcast_addr || routedmx->dvb_mabr) ) {
-			gf_sk_group_unregister(routedmx->active_sockets, *sock);
+			gf_route_sock_unregister(routedmx, s, *sock);
 			gf_sk_del(*sock);
 			*sock = NULL;
 			if (mcast_sess->mcast_addr)
@@ -3737,4 +4331,14 @@ GF_Err gf_route_dmx_mark_active_quality(GF_ROUTEDmx *routedmx, u32 service_id, c
 	return GF_OK;
 }
 
+GF_Err gf_route_dmx_mark_active_quality(GF_ROUTEDmx *routedmx, u32 service_id, const char *period_id, s32 as_id, const char *rep_id, Bool is_selected)
+{
+	GF_Err e;
+	if (!routedmx) return GF_BAD_PARAM;
+	gf_route_dmx_pause_workers(routedmx, GF_TRUE);
+	e = gf_route_dmx_mark_active_quality_internal(routedmx, service_id, period_id, as_id, rep_id, is_selected);
+	gf_route_dmx_pause_workers(routedmx, GF_FALSE);
+	return e;
+}
+
 #endif /* !GPAC_DISABLE_ROUTE */
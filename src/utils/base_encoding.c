@@ -248,6 +248,72 @@ GF_Err gf_gz_compress_payload(u8 **data, u32 data_len, u32 *max_size)
 	return gf_gz_compress_payload_ex(data, data_len, max_size, 0, GF_FALSE, NULL, GF_FALSE);
 }
 
+struct __gf_gz_compressor
+{
+	z_stream stream;
+	u8 *output;
+	u32 output_alloc;
+};
+
+GF_EXPORT
+GF_GZCompressor *gf_gz_compressor_new(s32 level, u32 strategy)
+{
+	GF_GZCompressor *gzc;
+	GF_SAFEALLOC(gzc, GF_GZCompressor);
+	if (!gzc) return NULL;
+	if (level>9) level = 9;
+	else if (level<0) level = Z_DEFAULT_COMPRESSION;
+	if (strategy>Z_FIXED) strategy = Z_DEFAULT_STRATEGY;
+
+	//same as deflateInit(level) for default strategy
+	if (deflateInit2(&gzc->stream, level, Z_DEFLATED, MAX_WBITS, 8, strategy) != Z_OK) {
+		gf_free(gzc);
+		return NULL;
+	}
+	return gzc;
+}
+
+GF_EXPORT
+void gf_gz_compressor_del(GF_GZCompressor *gzc)
+{
+	if (!gzc) return;
+	deflateEnd(&gzc->stream);
+	if (gzc->output) gf_free(gzc->output);
+	gf_free(gzc);
+}
+
+GF_EXPORT
+GF_Err gf_gz_compressor_process(GF_GZCompressor *gzc, const u8 *data, u32 data_len, u8 **out_data, u32 *out_size)
+{
+	int err;
+	u32 max_size;
+	if (!gzc || !out_data || !out_size) return GF_BAD_PARAM;
+
+	//reset state, keeps allocated window and hash tables
+	if (deflateReset(&gzc->stream) != Z_OK) return GF_IO_ERR;
+
+	max_size = (u32) deflateBound(&gzc->stream, data_len);
+	if (gzc->output_alloc < max_size) {
+		gzc->output = gf_realloc(gzc->output, max_size);
+		if (!gzc->output) {
+			gzc->output_alloc = 0;
+			return GF_OUT_OF_MEM;
+		}
+		gzc->output_alloc = max_size;
+	}
+	gzc->stream.next_in = (Bytef*) data;
+	gzc->stream.avail_in = (uInt) data_len;
+	gzc->stream.next_out = (Bytef*) gzc->output;
+	gzc->stream.avail_out = (uInt) gzc->output_alloc;
+
+	err = deflate(&gzc->stream, Z_FINISH);
+	if (err != Z_STREAM_END) return GF_IO_ERR;
+
+	*out_data = gzc->output;
+	*out_size = (u32) gzc->stream.total_out;
+	return GF_OK;
+}
+
 GF_EXPORT
 GF_Err gf_gz_decompress_payload_ex(u8 *data, u32 data_len, u8 **uncompressed_data, u32 *out_size, Bool use_gz)
 {
@@ -337,6 +403,21 @@ GF_Err gf_gz_compress_payload_ex(u8 **data, u32 data_len, u32 *max_size, u8 data
 	*max_size = 0;
 	return GF_NOT_SUPPORTED;
 }
+GF_EXPORT
+GF_GZCompressor *gf_gz_compressor_new(s32 level, u32 strategy)
+{
+	return NULL;
+}
+GF_EXPORT
+void gf_gz_compressor_del(GF_GZCompressor *gzc)
+{
+}
+GF_EXPORT
+GF_Err gf_gz_compressor_process(GF_GZCompressor *gzc, const u8 *data, u32 data_len, u8 **out_data, u32 *out_size)
+{
+	*out_size = 0;
+	return GF_NOT_SUPPORTED;
+}
 #endif /*GPAC_DISABLE_ZLIB*/
 
 
@@ -1520,6 +1520,119 @@ Bool gf_pixel_get_size_info(GF_PixelFormat pixfmt, u32 width, u32 height, u32 *o
 	return GF_TRUE;
 }
 
+GF_EXPORT
+Bool gf_pixel_get_planes(GF_PixelFormat pixfmt, u32 width, u32 height, u32 stride, u32 stride_uv, GF_PixelPlanes *planes)
+{
+	u32 i, nb_planes, uv_height, line_size, line_size_uv;
+	if (!planes) return GF_FALSE;
+	memset(planes, 0, sizeof(GF_PixelPlanes));
+
+	//get line sizes without padding
+	line_size = line_size_uv = 0;
+	if (!gf_pixel_get_size_info(pixfmt, width, height, NULL, &line_size, &line_size_uv, NULL, NULL))
+		return GF_FALSE;
+	if (!gf_pixel_get_size_info(pixfmt, width, height, &planes->size, &stride, &stride_uv, &nb_planes, &uv_height))
+		return GF_FALSE;
+
+	if (nb_planes>4) nb_planes = 4;
+	planes->nb_planes = nb_planes;
+	for (i=0; i<nb_planes; i++) {
+		//alpha/depth plane has the same layout as the first plane
+		if ((i==1) || (i==2)) {
+			planes->stride[i] = stride_uv;
+			planes->height[i] = uv_height;
+			planes->line_size[i] = line_size_uv;
+		} else {
+			planes->stride[i] = stride;
+			planes->height[i] = height;
+			planes->line_size[i] = line_size;
+		}
+		if (planes->line_size[i] > planes->stride[i])
+			planes->line_size[i] = planes->stride[i];
+		if (i)
+			planes->offset[i] = planes->offset[i-1] + planes->stride[i-1] * planes->height[i-1];
+	}
+	return GF_TRUE;
+}
+
+#include <gpac/internal/simd_dev.h>
+
+//planes larger than this are copied with non-temporal stores to avoid evicting the cache
+#define PIXEL_COPY_STREAM_SIZE	(4*1024*1024)
+
+#ifdef GPAC_HAS_SSE2
+static void pixel_copy_stream(u8 *dst, const u8 *src, u32 size)
+{
+	u32 head = (u32) ((16 - ((size_t) dst & 15)) & 15);
+	if (head > size) head = size;
+	if (head) {
+		memcpy(dst, src, head);
+		dst += head;
+		src += head;
+		size -= head;
+	}
+	while (size >= 64) {
+		__m128i v0 = _mm_loadu_si128((const __m128i *) src);
+		__m128i v1 = _mm_loadu_si128((const __m128i *) (src+16));
+		__m128i v2 = _mm_loadu_si128((const __m128i *) (src+32));
+		__m128i v3 = _mm_loadu_si128((const __m128i *) (src+48));
+		_mm_stream_si128((__m128i *) dst, v0);
+		_mm_stream_si128((__m128i *) (dst+16), v1);
+		_mm_stream_si128((__m128i *) (dst+32), v2);
+		_mm_stream_si128((__m128i *) (dst+48), v3);
+		src += 64;
+		dst += 64;
+		size -= 64;
+	}
+	if (size) memcpy(dst, src, size);
+}
+#endif
+
+GF_EXPORT
+void gf_pixel_copy_plane(u8 *dst, u32 dst_stride, const u8 *src, u32 src_stride, u32 line_size, u32 nb_lines)
+{
+	u32 i;
+#ifdef GPAC_HAS_SSE2
+	Bool use_stream;
+#endif
+	if (!dst || !src || !line_size || !nb_lines) return;
+
+	//contiguous lines on both sides, copy all lines at once
+	if ((dst_stride == line_size) && (src_stride == line_size) && ((u64) line_size * nb_lines < 0xFFFFFFFFUL)) {
+		line_size += src_stride * (nb_lines-1);
+		nb_lines = 1;
+	}
+#ifdef GPAC_HAS_SSE2
+	use_stream = ((u64) line_size * nb_lines >= PIXEL_COPY_STREAM_SIZE) ? GF_TRUE : GF_FALSE;
+	if (use_stream) {
+		for (i=0; i<nb_lines; i++) {
+			pixel_copy_stream(dst, src, line_size);
+			dst += dst_stride;
+			src += src_stride;
+		}
+		_mm_sfence();
+		return;
+	}
+#endif
+	for (i=0; i<nb_lines; i++) {
+		memcpy(dst, src, line_size);
+		dst += dst_stride;
+		src += src_stride;
+	}
+}
+
+GF_EXPORT
+void gf_pixel_copy_frame(const GF_PixelPlanes *layout, u8 *dst_planes[4], const u32 *dst_strides, const u8 *src_planes[4], const u32 *src_strides)
+{
+	u32 i;
+	if (!layout) return;
+	for (i=0; i<layout->nb_planes; i++) {
+		gf_pixel_copy_plane(dst_planes[i], dst_strides ? dst_strides[i] : layout->stride[i],
+			src_planes[i], src_strides ? src_strides[i] : layout->stride[i],
+			layout->line_size[i], layout->height[i]);
+	}
+}
+
 GF_EXPORT
 Bool gf_pixel_fmt_is_transparent(GF_PixelFormat pixfmt)
 {
@@ -1931,6 +1931,12 @@ Bool gf_sk_has_nrt_netcap(GF_Socket *sk)
 	return GF_FALSE;
 }
 
+Bool gf_sk_has_netcap(GF_Socket *sk)
+{
+	if (sk && sk->cap_info) return GF_TRUE;
+	return GF_FALSE;
+}
+
 GF_EXPORT
 GF_Socket *gf_sk_new_ex(u32 SocketType, const char *netcap_id)
 {
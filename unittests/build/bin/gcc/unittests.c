@@ -0,0 +1,35 @@
+#include <stdio.h>
+#include <stdlib.h> // EXIT_FAILURE
+
+int register_test(const char *name, int (*test_function)(void));
+int run_tests(int argc, char *argv[]);
+
+#define unittest(ut)                                                                                                   \
+  int test_##ut();                                                                                                     \
+  if(register_test(#ut, test_##ut)) {                                                                                  \
+    fprintf(stderr, "registration failed for unit test: %s\n", #ut);                                                   \
+    return EXIT_FAILURE;                                                                                               \
+  }
+
+int main(int argc, char *argv[])
+{
+  unittest(scte35dec_safety);
+  unittest(scte35dec_no_event);
+  unittest(scte35dec_segmentation_no_event);
+  unittest(scte35dec_splice_point_with_idr);
+  unittest(scte35dec_repeated_section);
+  unittest(scte35dec_simple);
+  unittest(scte35dec_segmentation_beginning);
+  unittest(scte35dec_segmentation_end);
+  unittest(dasher_srcsegs_exact_sidx);
+  unittest(dasher_srcsegs_reserve_kept);
+  unittest(vflip_packed_rgb);
+  unittest(vflip_packed_422);
+  unittest(compose_burnin_y4m_srt);
+  unittest(route_worker_threads_loopback);
+  unittest(gf_sys_word_match);
+  unittest(xml_translate_xml_string);
+
+  return run_tests(argc, argv);
+}
+
@@ -0,0 +1,190 @@
+# Automatically generated by configure - do not modify
+GPAC_CONFIGURATION=
+prefix=/usr/local
+DESTDIR=
+moddir=gpac
+MAKE=make
+CC=@gcc
+AR=@ar
+RANLIB=@ranlib
+STRIP=@strip
+WINDRES=windres
+INSTALL=install
+LIBTOOL=@libtool
+INSTFLAGS=-p
+OPTFLAGS=-O3   -Wall -fno-strict-aliasing -Wno-pointer-sign -fPIC -DPIC -msse2 -DNDEBUG -std=gnu99 -Wno-deprecated -Wno-deprecated-declarations -Wno-int-in-bool-context -DGPAC_HAVE_CONFIG_H -I"/root/repo/unittests/build" -fvisibility="hidden"
+CXXFLAGS=  -Wall -fno-strict-aliasing -fPIC -DPIC
+LDFLAGS= -Wl,--warn-common -Wl,-z,defs
+SHFLAGS=-shared
+lib_dir=lib
+man_dir=share/man
+UNIT_TESTS=no
+STATIC_MODULES=no
+EXTRALIBS=-lm
+LIBGPAC_CFLAGS=
+LIBGPAC_LDFLAGS=
+VERSION=2.5-DEV
+VERSION_MAJOR=12
+VERSION_SONAME=12.15.0
+CONFIG_LINUX=yes
+GPAC_SH_FLAGS=-lpthread -llzma
+EXE_SUFFIX=
+DYN_LIB_SUFFIX=.so
+INSTFLAGS=
+CONFIG_JS=yes
+HAS_OPENSSL=system (pkgconfig)
+DISABLE_THREADS=no
+CONFIG_ZLIB=system (pkgconfig)
+CONFIG_FT=system (pkgconfig)
+CONFIG_STRLCPY=no
+CONFIG_LZMA=yes
+CONFIG_OSS_AUDIO=yes
+CONFIG_ALSA=no
+CONFIG_JACK=no
+CONFIG_PULSEAUDIO=no
+CONFIG_FREENECT=no
+CONFIG_CACA=no
+zlib_cflags=
+zlib_ldflags=-lz
+opensvc_cflags=
+opensvc_ldflags=
+openhevc_cflags=
+openhevc_ldflags=
+platinum_cflags=
+platinum_ldflags=
+freetype_cflags=-I/usr/include/freetype2 -I/usr/include/libpng16
+freetype_ldflags=-lfreetype
+ssl_cflags=
+ssl_ldflags=-lssl -lcrypto
+jpeg_cflags=
+jpeg_ldflags=-ljpeg
+openjpeg_cflags=
+openjpeg_ldflags=
+png_cflags=-I/usr/include/libpng16
+png_ldflags=-lpng16
+mad_cflags=
+mad_ldflags=
+a52_cflags=
+a52_ldflags=
+xvid_cflags=
+xvid_ldflags=
+faad_cflags=
+faad_ldflags=
+ffmpeg_cflags=
+ffmpeg_ldflags=
+freenect_cflags=
+freenect_ldflags=
+vorbis_cflags=
+vorbis_ldflags=
+theora_cflags=
+theora_ldflags=
+nghttp2_cflags=
+nghttp2_ldflags=
+oss_cflags=
+oss_ldflags=
+dvb4linux_cflags=
+dvb4linux_ldflags=
+alsa_cflags=
+alsa_ldflags=
+pulseaudio_cflags=
+pulseaudio_ldflags=
+jack_cflags=
+jack_ldflags=
+directfb_cflags=
+directfb_ldflags=
+hid_cflags=
+hid_ldflags=
+lzma_cflags=
+lzma_ldflags=
+tinygl_cflags=
+tinygl_ldflags=
+vtb_cflags=
+vtb_ldflags=
+ogg_cflags=
+ogg_ldflags=
+sdl_cflags=
+sdl_ldflags=
+caption_cflags=
+caption_ldflags=
+mpeghdec_cflags=
+mpeghdec_ldflags=
+libcaca_cflags=
+libcaca_ldflags=
+curl_cflags=
+curl_ldflags=-lcurl
+DISABLE_COMPOSITOR=no
+DISABLE_STREAMING=no
+DISABLE_SVG=no
+DISABLE_LASER=no
+DISABLE_SAF=no
+DISABLE_BIFS=no
+DISABLE_SENG=no
+DISABLE_LOADER_ISOFF=no
+DISABLE_LOADER_BT=no
+DISABLE_LOADER_XMT=no
+DISABLE_LOADER_QTVR=no
+DISABLE_LOADER_SWF=no
+DISABLE_SCENE_STATS=no
+DISABLE_SCENE_DUMP=no
+DISABLE_SCENE_ENCODE=no
+DISABLE_SCENEGRAPH=no
+DISABLE_CRYPTO=no
+DISABLE_DVBX=yes
+DISABLE_AVILIB=no
+DISABLE_M2PS=no
+DISABLE_OGG=no
+DISABLE_ISOFF=no
+DISABLE_ISOFF_HINT=no
+DISABLE_VOBSUB=no
+DISABLE_TTXT=no
+DISABLE_TTML=no
+DISABLE_SMGR=no
+DISABLE_AV_PARSERS=no
+DISABLE_MEDIA_IMPORT=no
+DISABLE_MEDIA_EXPORT=no
+DISABLE_CORE_TOOLS=
+DISABLE_OD_DUMP=no
+DISABLE_OD_PARSE=no
+MINIMAL_OD=
+DISABLE_ISOM_ADOBE=no
+DISABLE_VRML=no
+DISABLE_ROUTE=no
+DISABLE_CRYPTO=no
+DISABLE_M2TS_MUX=no
+DISABLE_M2TS=no
+GPAC_USE_TINYGL=no
+OGL_INCLS=
+HAS_OPENGL=yes
+OGL_LIBS=-lGL -lGLU -lX11
+CONFIG_SDL=no
+DEBUGBUILD=no
+GPROFBUILD=no
+STATIC_BINARY=no
+STATIC_BUILD=no
+CONFIG_IPV6=yes
+CONFIG_PLATINUM=no
+CONFIG_OPENHEVC=no
+LINUX_DVB=yes
+CONFIG_DIRECTFB=no
+CONFIG_X11=yes
+USE_X11_SHM=yes
+USE_X11_GLX=yes
+X11_LIB_PATH=/usr/X11R6/lib64
+X11_INC_PATH=/usr/X11R6/include
+CONFIG_HID=no
+PKG_CONFIG=pkg-config
+SRC_PATH=/root/repo
+BUILD_PATH=/root/repo/unittests/build
+LOCAL_INC_PATH=/root/repo/extra_lib/include
+%.opic : %.c
+	@echo "  CC $<"
+	$(CC) $(CFLAGS) $(PIC_CFLAGS) -c $< -o $@
+%.o : %.c
+	@echo "  CC $<"
+	$(CC) $(CFLAGS) -c -o $@ $<
+%.o: %.cpp
+	@echo "  CC $<"
+	$(CXX) $(CFLAGS) -c -o $@ $<
+%.o: %.rc
+	@echo "  RC $<"
+	$(WINDRES) $< -o $@ 
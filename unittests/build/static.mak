@@ -0,0 +1 @@
+/root/repo/static.mak
\ No newline at end of file